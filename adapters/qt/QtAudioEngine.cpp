@@ -56,6 +56,10 @@ void QtAudioEngine::play(const std::string& path) {
     start();
 }
 
+void QtAudioEngine::measure(const int duration) const {
+    progress_bar_->measure(duration);
+}
+
 void QtAudioEngine::resume() {
     start();
 }
@@ -26,6 +26,7 @@ public:
     void setup() override;
     void wire() override;
     void play(const std::string& path);
+    void measure(int duration) const;
     void resume();
     void pause();
     void stop() const;
@@ -28,7 +28,22 @@ void QtDisplayWidget::wire(IDisplayControl& listener) {
     });
 }
 
-void QtDisplayWidget::refresh(const std::vector<std::string>& names) { display_->refresh(names); }
+void QtDisplayWidget::refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) { display_->refresh(std::move(playlist)); }
+
+void QtDisplayWidget::insert(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                             const std::size_t count) {
+    display_->insert(std::move(playlist), first, count);
+}
+
+void QtDisplayWidget::erase(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                            const std::size_t count) {
+    display_->erase(std::move(playlist), first, count);
+}
+
+void QtDisplayWidget::reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) {
+    display_->reorder(std::move(playlist), order);
+}
+
 void QtDisplayWidget::highlight(const int index) { display_->highlight(index); }
 void QtDisplayWidget::suggest(const std::vector<std::string>& names) { search_overlay_->display(names); }
 void QtDisplayWidget::dismiss() { search_overlay_->clear(); }
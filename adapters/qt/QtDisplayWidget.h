@@ -22,7 +22,10 @@ private:
 public:
     QtDisplayWidget(QWidget* parent, QVBoxLayout* layout);
     void wire(IDisplayControl& listener);
-    void refresh(const std::vector<std::string>& names) override;
+    void refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) override;
+    void insert(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) override;
+    void erase(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) override;
+    void reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) override;
     void highlight(int index) override;
     void suggest(const std::vector<std::string>& names) override;
     void dismiss() override;
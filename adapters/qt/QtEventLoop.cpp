@@ -0,0 +1,8 @@
+#include "QtEventLoop.h"
+#include <QMetaObject>
+
+QtEventLoop::QtEventLoop(QObject* context) : context_(context) {}
+
+void QtEventLoop::post(std::function<void()> task) {
+    QMetaObject::invokeMethod(context_, std::move(task), Qt::QueuedConnection);
+}
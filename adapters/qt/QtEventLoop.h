@@ -0,0 +1,16 @@
+#ifndef QT_EVENT_LOOP_H
+#define QT_EVENT_LOOP_H
+
+#include "model/events/IEventLoop.h"
+#include <QObject>
+
+class QtEventLoop final : public IEventLoop {
+private:
+    QObject* context_;
+
+public:
+    explicit QtEventLoop(QObject* context);
+    void post(std::function<void()> task) override;
+};
+
+#endif //QT_EVENT_LOOP_H
@@ -19,6 +19,7 @@ std::string QtLibraryWidget::browse() { return dialog_->browse(); }
 bool QtLibraryWidget::confirm(const std::string& message) { return dialog_->confirm(message); }
 void QtLibraryWidget::reveal(const bool visible) { toolbar_->reveal(visible); }
 void QtLibraryWidget::enable(const bool state) { toolbar_->enable(state); }
+void QtLibraryWidget::progress(const std::string& name, const int percent) { toolbar_->progress(name, percent); }
 
 void QtLibraryWidget::onSkip(const std::function<void()>& callback) const {
     QObject::connect(toolbar_, &QtToolbar::skipClicked, toolbar_, callback);
@@ -22,6 +22,7 @@ public:
     bool confirm(const std::string& message) override;
     void reveal(bool visible) override;
     void enable(bool state) override;
+    void progress(const std::string& name, int percent) override;
     void onSkip(const std::function<void()>& callback) const;
     void onRemove(const std::function<void()>& callback) const;
 };
@@ -24,6 +24,7 @@ void QtPlaybackWidget::attach(IPlaybackControl& listener) {
 }
 
 void QtPlaybackWidget::play(const std::string& path) { audio_->play(path); }
+void QtPlaybackWidget::measure(const int duration) { audio_->measure(duration); }
 void QtPlaybackWidget::pause() { audio_->pause(); }
 void QtPlaybackWidget::resume() { audio_->resume(); }
 void QtPlaybackWidget::stop() { audio_->stop(); }
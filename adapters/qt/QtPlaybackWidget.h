@@ -23,6 +23,7 @@ public:
     QtPlaybackWidget(QWidget* parent, QVBoxLayout* layout);
     void attach(IPlaybackControl& listener);
     void play(const std::string& path) override;
+    void measure(int duration) override;
     void pause() override;
     void resume() override;
     void stop() override;
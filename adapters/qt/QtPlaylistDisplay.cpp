@@ -12,8 +12,9 @@ void QtPlaylistDisplay::setup() {
     auto* layout = new QVBoxLayout(this);
     QtLayoutUtil::flatten(layout);
 
-    list_model_ = new QStringListModel(this);
+    list_model_ = new QtPlaylistModel(this);
     playlist_ = new QListView(this);
+    playlist_->setUniformItemSizes(true);
     playlist_->setModel(list_model_);
 
     layout->addWidget(playlist_);
@@ -23,12 +24,23 @@ void QtPlaylistDisplay::setup() {
     });
 }
 
-void QtPlaylistDisplay::refresh(const std::vector<std::string>& names) const {
-    QStringList list;
-    for (const auto& name : names) {
-        list.append(QString::fromStdString(name));
-    }
-    list_model_->setStringList(list);
+void QtPlaylistDisplay::refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) const {
+    list_model_->update(std::move(playlist));
+}
+
+void QtPlaylistDisplay::insert(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                               const std::size_t count) const {
+    list_model_->insert(std::move(playlist), first, count);
+}
+
+void QtPlaylistDisplay::erase(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                              const std::size_t count) const {
+    list_model_->erase(std::move(playlist), first, count);
+}
+
+void QtPlaylistDisplay::reorder(std::shared_ptr<const IPlaylistSnapshot> playlist,
+                                const std::vector<std::size_t>& order) const {
+    list_model_->reorder(std::move(playlist), order);
 }
 
 void QtPlaylistDisplay::highlight(const int index) const {
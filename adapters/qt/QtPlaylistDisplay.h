@@ -1,8 +1,9 @@
 #ifndef QT_PLAYLIST_DISPLAY_H
 #define QT_PLAYLIST_DISPLAY_H
 
+#include "QtPlaylistModel.h"
 #include <QListView>
-#include <QStringListModel>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,13 +11,16 @@ class QtPlaylistDisplay final : public QWidget {
     Q_OBJECT
 private:
     QListView* playlist_;
-    QStringListModel* list_model_;
+    QtPlaylistModel* list_model_;
 
     void setup();
 
 public:
     explicit QtPlaylistDisplay(QWidget* parent = nullptr);
-    void refresh(const std::vector<std::string>& names) const;
+    void refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) const;
+    void insert(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) const;
+    void erase(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) const;
+    void reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) const;
     void highlight(int index) const;
     void remove();
 
@@ -0,0 +1,62 @@
+#include "QtPlaylistModel.h"
+
+QtPlaylistModel::QtPlaylistModel(QObject* parent) : QAbstractListModel(parent) {}
+
+void QtPlaylistModel::update(std::shared_ptr<const IPlaylistSnapshot> next) {
+    beginResetModel();
+    snapshot_ = std::move(next);
+    rows_ = snapshot_ ? snapshot_->size() : 0;
+    endResetModel();
+}
+
+int QtPlaylistModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(count());
+}
+
+QVariant QtPlaylistModel::data(const QModelIndex& index, const int role) const {
+    if (role != Qt::DisplayRole || !index.isValid() || index.row() >= rowCount() ||
+        static_cast<std::size_t>(index.row()) >= snapshot_->size()) return {};
+    const std::string_view name = snapshot_->name(index.row());
+    return QString::fromUtf8(name.data(), static_cast<qsizetype>(name.size()));
+}
+
+std::size_t QtPlaylistModel::count() const {
+    return rows_;
+}
+
+void QtPlaylistModel::insert(std::shared_ptr<const IPlaylistSnapshot> next, const std::size_t first,
+                             const std::size_t count) {
+    if (count == 0 || first > rows_) return update(std::move(next));
+    beginInsertRows({}, static_cast<int>(first), static_cast<int>(first + count - 1));
+    snapshot_ = std::move(next);
+    rows_ += count;
+    endInsertRows();
+}
+
+void QtPlaylistModel::erase(std::shared_ptr<const IPlaylistSnapshot> next, const std::size_t first,
+                            const std::size_t count) {
+    if (count == 0 || first + count > rows_) return update(std::move(next));
+    beginRemoveRows({}, static_cast<int>(first), static_cast<int>(first + count - 1));
+    snapshot_ = std::move(next);
+    rows_ -= count;
+    endRemoveRows();
+}
+
+void QtPlaylistModel::reorder(std::shared_ptr<const IPlaylistSnapshot> next, const std::vector<std::size_t>& order) {
+    if (order.size() != rows_) return update(std::move(next));
+
+    emit layoutAboutToBeChanged();
+    const QModelIndexList previous = persistentIndexList();
+    std::vector<int> rows(order.size());
+    for (std::size_t row = 0; row < order.size(); row++) {
+        rows[order[row]] = static_cast<int>(row);
+    }
+    QModelIndexList current;
+    current.reserve(previous.size());
+    for (const QModelIndex& index : previous) {
+        current.append(this->index(rows[index.row()], 0));
+    }
+    changePersistentIndexList(previous, current);
+    snapshot_ = std::move(next);
+    emit layoutChanged();
+}
@@ -0,0 +1,27 @@
+#ifndef QT_PLAYLIST_MODEL_H
+#define QT_PLAYLIST_MODEL_H
+
+#include "../../view/IPlaylistSnapshot.h"
+#include <QAbstractListModel>
+#include <memory>
+#include <vector>
+
+class QtPlaylistModel final : public QAbstractListModel {
+    Q_OBJECT
+private:
+    std::shared_ptr<const IPlaylistSnapshot> snapshot_;
+    std::size_t rows_ = 0;
+
+    std::size_t count() const;
+
+public:
+    explicit QtPlaylistModel(QObject* parent = nullptr);
+    void update(std::shared_ptr<const IPlaylistSnapshot> next);
+    void insert(std::shared_ptr<const IPlaylistSnapshot> next, std::size_t first, std::size_t count);
+    void erase(std::shared_ptr<const IPlaylistSnapshot> next, std::size_t first, std::size_t count);
+    void reorder(std::shared_ptr<const IPlaylistSnapshot> next, const std::vector<std::size_t>& order);
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+};
+
+#endif //QT_PLAYLIST_MODEL_H
@@ -31,8 +31,7 @@ void QtProgressPanel::wire(QMediaPlayer& media) {
     });
 
     connect(&media, &QMediaPlayer::durationChanged, this, [this](const qint64 duration) {
-        progress_bar_->setMaximum(static_cast<int>(duration));
-        total_time_->setText(format(duration));
+        if (duration > 0) measure(duration);
     });
 
     connect(progress_bar_, &QSlider::sliderReleased, this, [&media, this]() {
@@ -44,6 +43,11 @@ void QtProgressPanel::enable(const bool state) const {
     progress_bar_->setEnabled(state);
 }
 
+void QtProgressPanel::measure(const qint64 duration) const {
+    progress_bar_->setMaximum(static_cast<int>(duration));
+    total_time_->setText(format(duration));
+}
+
 QString QtProgressPanel::format(const qint64 milliseconds) {
     const int seconds = static_cast<int>(milliseconds / 1000);
     const int minutes = seconds / 60;
@@ -20,6 +20,7 @@ private:
 public:
     QtProgressPanel(QMediaPlayer& media, QWidget* parent = nullptr);
     void enable(bool state) const;
+    void measure(qint64 duration) const;
 };
 
 #endif //QT_PROGRESS_PANEL_H
\ No newline at end of file
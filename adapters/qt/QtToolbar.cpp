@@ -37,4 +37,14 @@ void QtToolbar::enable(const bool state) const {
 
 void QtToolbar::reveal(const bool visible) const {
     skip_button_->setVisible(visible);
-}
\ No newline at end of file
+}
+
+void QtToolbar::progress(const std::string& name, const int percent) const {
+    if (percent >= 100) {
+        add_button_->setText("Add Song");
+        add_button_->setToolTip("");
+        return;
+    }
+    add_button_->setText(QString("Importing %1%").arg(percent));
+    add_button_->setToolTip(QString::fromStdString(name));
+}
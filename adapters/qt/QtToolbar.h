@@ -3,6 +3,7 @@
 
 #include <QWidget>
 #include <QPushButton>
+#include <string>
 #include "IWidgetSetup.h"
 
 class QtToolbar final : public QWidget, public IWidgetSetup {
@@ -18,6 +19,7 @@ public:
     void wire() override;
     void enable(bool state) const;
     void reveal(bool visible) const;
+    void progress(const std::string& name, int percent) const;
 
 signals:
     void addClicked();
@@ -0,0 +1,83 @@
+#include "model/events/Broadcaster.h"
+#include "model/events/LibraryEventNotifier.h"
+#include "model/events/PlaybackNotifier.h"
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kSubscribers = 3;
+
+class Sink final : public ILibraryEvent {
+public:
+    int received = 0;
+
+    void onReveal(const bool visible) override { received += visible; }
+    void onEnabled(const bool state) override { received += state; }
+    void onSelected(const int index) override { received += index; }
+    void onProgress(const std::string& name, const int percent) override { received += percent + !name.empty(); }
+};
+
+void fanOut(const std::vector<ILibraryEvent*>& observers, const std::function<void(ILibraryEvent*)>& action) {
+    for (auto* observer : observers) {
+        action(observer);
+    }
+}
+
+void FunctionFanOut(benchmark::State& state) {
+    std::vector<Sink> sinks(kSubscribers);
+    std::vector<ILibraryEvent*> observers;
+    for (Sink& sink : sinks) {
+        observers.push_back(&sink);
+    }
+    const std::string name = "song.mp3";
+    int percent = 0;
+    for (auto _ : state) {
+        fanOut(observers, [&](ILibraryEvent* observer) {
+            observer->onProgress(name, percent);
+        });
+        percent = (percent + 1) % 100;
+    }
+    benchmark::DoNotOptimize(sinks.front().received);
+}
+
+void BroadcasterFanOut(benchmark::State& state) {
+    std::vector<Sink> sinks(kSubscribers);
+    Broadcaster<ILibraryEvent> observers;
+    for (Sink& sink : sinks) {
+        observers.add(sink);
+    }
+    const std::string name = "song.mp3";
+    int percent = 0;
+    for (auto _ : state) {
+        observers.notify<&ILibraryEvent::onProgress>(name, percent);
+        percent = (percent + 1) % 100;
+    }
+    benchmark::DoNotOptimize(sinks.front().received);
+}
+
+void NotifierChain(benchmark::State& state) {
+    std::vector<Sink> sinks(kSubscribers);
+    LibraryEventNotifier library;
+    for (Sink& sink : sinks) {
+        library.subscribe(sink);
+    }
+    PlaybackNotifier notifier;
+    notifier.add(library);
+    const std::string name = "song.mp3";
+    int percent = 0;
+    for (auto _ : state) {
+        notifier.onProgress(name, percent);
+        notifier.onSelected(percent);
+        percent = (percent + 1) % 100;
+    }
+    benchmark::DoNotOptimize(sinks.front().received);
+}
+
+}
+
+BENCHMARK(FunctionFanOut);
+BENCHMARK(BroadcasterFanOut);
+BENCHMARK(NotifierChain);
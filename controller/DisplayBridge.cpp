@@ -1,17 +1,23 @@
 #include "DisplayBridge.h"
 #include "PlaylistRenderer.h"
+#include <utility>
 
 DisplayBridge::DisplayBridge(MusicPlayer& musicPlayer, IDisplayView& view)
     : music_player_(musicPlayer), view_(view) {
     render();
 }
 
-void DisplayBridge::onChanged() { render(); }
+void DisplayBridge::onChanged() {
+    if (!std::exchange(rendered_, false)) render();
+}
+
+void DisplayBridge::onDelta(const PlaylistDelta& delta) {
+    PlaylistRenderer(view_).render(music_player_.songs(), delta);
+    rendered_ = true;
+}
 
 void DisplayBridge::onSelected(const int index) { view_.highlight(index); }
 
 void DisplayBridge::render() const {
-    PlaylistRenderer renderer(view_);
-    music_player_.accept(renderer);
-    renderer.render();
+    PlaylistRenderer(view_).render(music_player_.songs());
 }
@@ -9,6 +9,7 @@ class DisplayBridge final : public IDisplayEvent {
 private:
     MusicPlayer& music_player_;
     IDisplayView& view_;
+    bool rendered_ = false;
 
     void render() const;
 
@@ -16,6 +17,7 @@ public:
     DisplayBridge(MusicPlayer& musicPlayer, IDisplayView& view);
 
     void onChanged() override;
+    void onDelta(const PlaylistDelta& delta) override;
     void onSelected(int index) override;
 };
 
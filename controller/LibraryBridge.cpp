@@ -5,3 +5,4 @@ LibraryBridge::LibraryBridge(ILibraryView& view) : view_(view) {}
 void LibraryBridge::onReveal(const bool visible) { view_.reveal(visible); }
 void LibraryBridge::onEnabled(const bool state) { view_.enable(state); }
 void LibraryBridge::onSelected(int) { view_.enable(true); }
+void LibraryBridge::onProgress(const std::string& name, const int percent) { view_.progress(name, percent); }
@@ -14,6 +14,7 @@ public:
     void onReveal(bool visible) override;
     void onEnabled(bool state) override;
     void onSelected(int index) override;
+    void onProgress(const std::string& name, int percent) override;
 };
 
 #endif //LIBRARY_BRIDGE_H
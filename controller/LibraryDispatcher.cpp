@@ -6,7 +6,7 @@ LibraryDispatcher::LibraryDispatcher(MusicPlayer& musicPlayer, ILibraryView& vie
 void LibraryDispatcher::add() {
     const std::string path = view_.browse();
     if (!path.empty()) {
-        music_player_.insert(path);
+        music_player_.import(path);
     }
 }
 
@@ -17,7 +17,5 @@ void LibraryDispatcher::remove(const int index) {
 }
 
 void LibraryDispatcher::drop(const std::vector<std::string>& paths) {
-    for (const auto& path : paths) {
-        music_player_.insert(path);
-    }
+    music_player_.import(paths);
 }
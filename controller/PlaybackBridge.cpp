@@ -1,9 +1,11 @@
 #include "PlaybackBridge.h"
+#include "model/core/FileMetadata.h"
 
 PlaybackBridge::PlaybackBridge(IPlaybackView& view) : view_(view) {}
 
 void PlaybackBridge::onStart(const std::string& path) {
     view_.play(path);
+    view_.measure(FileMetadata(path).duration());
 }
 
 void PlaybackBridge::onSchedule(const int delay) {
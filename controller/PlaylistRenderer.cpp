@@ -1,17 +1,35 @@
 #include "PlaylistRenderer.h"
+#include "PlaylistSnapshot.h"
 
 PlaylistRenderer::PlaylistRenderer(IDisplayView& view)
     : view_(view) {
 }
 
-void PlaylistRenderer::visit(const std::string& name, const std::string&) {
-    names_.push_back(name);
+void PlaylistRenderer::render(const std::span<const Song> songs) const {
+    view_.refresh(std::make_shared<PlaylistSnapshot>(songs));
 }
 
-void PlaylistRenderer::render() const {
-    view_.refresh(names_);
+void PlaylistRenderer::render(const std::span<const Song> songs, const PlaylistDelta& delta) const {
+    if (delta.isEmpty()) return;
+    const auto snapshot = std::make_shared<PlaylistSnapshot>(songs);
+    for (const PlaylistDelta::Step& step : delta.steps()) {
+        switch (step.kind) {
+            case PlaylistDelta::Kind::Inserted: view_.insert(snapshot, step.first, step.count); break;
+            case PlaylistDelta::Kind::Removed: view_.erase(snapshot, step.first, step.count); break;
+            case PlaylistDelta::Kind::Moved: view_.reorder(snapshot, step.order); break;
+        }
+    }
 }
 
-void PlaylistRenderer::suggest() const {
-    view_.suggest(names_);
+void PlaylistRenderer::suggest(const std::span<const Song> songs) const {
+    view_.suggest(names(songs));
+}
+
+std::vector<std::string> PlaylistRenderer::names(const std::span<const Song> songs) {
+    std::vector<std::string> names;
+    names.reserve(songs.size());
+    for (const Song& song : songs) {
+        names.emplace_back(song.name());
+    }
+    return names;
 }
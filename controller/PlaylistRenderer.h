@@ -1,21 +1,24 @@
 #ifndef PLAYLIST_RENDERER_H
 #define PLAYLIST_RENDERER_H
 
-#include "model/events/IPlaylistVisitor.h"
+#include "model/core/Song.h"
+#include "model/events/PlaylistDelta.h"
 #include "../view/IDisplayView.h"
+#include <span>
 #include <vector>
 #include <string>
 
-class PlaylistRenderer final : public IPlaylistVisitor {
+class PlaylistRenderer final {
 private:
     IDisplayView& view_;
-    std::vector<std::string> names_;
+
+    static std::vector<std::string> names(std::span<const Song> songs);
 
 public:
     explicit PlaylistRenderer(IDisplayView& view);
-    void visit(const std::string& name, const std::string& path) override;
-    void render() const;
-    void suggest() const;
+    void render(std::span<const Song> songs) const;
+    void render(std::span<const Song> songs, const PlaylistDelta& delta) const;
+    void suggest(std::span<const Song> songs) const;
 };
 
 #endif //PLAYLIST_RENDERER_H
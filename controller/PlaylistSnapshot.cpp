@@ -0,0 +1,17 @@
+#include "PlaylistSnapshot.h"
+
+PlaylistSnapshot::PlaylistSnapshot(const std::span<const Song> songs)
+    : songs_(songs.begin(), songs.end()) {
+}
+
+std::size_t PlaylistSnapshot::size() const {
+    return songs_.size();
+}
+
+std::uint64_t PlaylistSnapshot::id(const std::size_t row) const {
+    return songs_[row].id();
+}
+
+std::string_view PlaylistSnapshot::name(const std::size_t row) const {
+    return songs_[row].name();
+}
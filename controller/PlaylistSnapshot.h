@@ -0,0 +1,20 @@
+#ifndef PLAYLIST_SNAPSHOT_H
+#define PLAYLIST_SNAPSHOT_H
+
+#include "../view/IPlaylistSnapshot.h"
+#include "model/core/Song.h"
+#include <span>
+#include <vector>
+
+class PlaylistSnapshot final : public IPlaylistSnapshot {
+private:
+    std::vector<Song> songs_;
+
+public:
+    explicit PlaylistSnapshot(std::span<const Song> songs);
+    std::size_t size() const override;
+    std::uint64_t id(std::size_t row) const override;
+    std::string_view name(std::size_t row) const override;
+};
+
+#endif //PLAYLIST_SNAPSHOT_H
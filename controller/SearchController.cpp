@@ -9,7 +9,5 @@ void SearchController::search(const std::string& query) const {
         view_.dismiss();
         return;
     }
-    PlaylistRenderer renderer(view_);
-    music_player_.search(query, renderer);
-    renderer.suggest();
+    PlaylistRenderer(view_).suggest(music_player_.find(query));
 }
@@ -4,18 +4,21 @@
 #include "model/arrangement/QuickSort.h"
 #include "model/arrangement/DurationSort.h"
 #include "model/arrangement/DateSort.h"
+#include "model/arrangement/AlbumSort.h"
 
 SortController::SortController(MusicPlayer& musicPlayer, IDisplayView& view)
     : music_player_(musicPlayer), view_(view) {
-    modes_.push_back(std::make_unique<SortMode>("Title \xe2\x96\xb2", new QuickSort()));
-    modes_.push_back(std::make_unique<TitleDescending>());
-    modes_.push_back(std::make_unique<SortMode>("Duration \xe2\x96\xb2", new DurationSort()));
-    modes_.push_back(std::make_unique<SortMode>("Date \xe2\x96\xb2", new DateSort()));
+    const auto title = std::make_shared<QuickSort>();
+    modes_.push_back(std::make_unique<SortMode>("Title \xe2\x96\xb2", title));
+    modes_.push_back(std::make_unique<TitleDescending>(title));
+    modes_.push_back(std::make_unique<SortMode>("Duration \xe2\x96\xb2", std::make_shared<DurationSort>()));
+    modes_.push_back(std::make_unique<SortMode>("Date \xe2\x96\xb2", std::make_shared<DateSort>()));
+    modes_.push_back(std::make_unique<SortMode>("Album \xe2\x96\xb2", std::make_shared<AlbumSort>()));
     modes_.push_back(std::make_unique<CustomMode>());
 }
 
 void SortController::cycle() {
     index_ = (index_ + 1) % static_cast<int>(modes_.size());
-    modes_[index_]->apply(music_player_);
+    music_player_.batch([this] { modes_[index_]->apply(music_player_); });
     modes_[index_]->display(view_);
 }
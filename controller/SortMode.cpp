@@ -1,7 +1,7 @@
 #include "SortMode.h"
 
-SortMode::SortMode(const std::string& label, ISortingAlgorithm* criteria)
-    : label_(label), criteria_(criteria) {}
+SortMode::SortMode(const std::string& label, std::shared_ptr<ISortingAlgorithm> criteria)
+    : label_(label), criteria_(std::move(criteria)) {}
 
 void SortMode::apply(MusicPlayer& musicPlayer) {
     musicPlayer.sort(*criteria_);
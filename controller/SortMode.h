@@ -12,10 +12,10 @@ private:
     std::string label_;
 
 protected:
-    std::unique_ptr<ISortingAlgorithm> criteria_;
+    std::shared_ptr<ISortingAlgorithm> criteria_;
 
 public:
-    SortMode(const std::string& label, ISortingAlgorithm* criteria);
+    SortMode(const std::string& label, std::shared_ptr<ISortingAlgorithm> criteria);
     virtual ~SortMode() = default;
     virtual void apply(MusicPlayer& musicPlayer);
     void display(IDisplayView& view) const;
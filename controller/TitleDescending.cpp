@@ -1,9 +1,8 @@
 #include "TitleDescending.h"
-#include "model/arrangement/QuickSort.h"
 
-TitleDescending::TitleDescending() : SortMode("Title \xe2\x96\xbc", new QuickSort()) {}
+TitleDescending::TitleDescending(std::shared_ptr<ISortingAlgorithm> ascending)
+    : SortMode("Title \xe2\x96\xbc", std::move(ascending)) {}
 
 void TitleDescending::apply(MusicPlayer& musicPlayer) {
-    musicPlayer.sort(*criteria_);
-    musicPlayer.reverse();
+    musicPlayer.sort(*criteria_, true);
 }
\ No newline at end of file
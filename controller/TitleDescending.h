@@ -5,7 +5,7 @@
 
 class TitleDescending final : public SortMode {
 public:
-    TitleDescending();
+    explicit TitleDescending(std::shared_ptr<ISortingAlgorithm> ascending);
     void apply(MusicPlayer& musicPlayer) override;
 };
 
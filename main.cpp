@@ -7,6 +7,7 @@
 #include "adapters/qt/QtPlaybackWidget.h"
 #include "adapters/qt/QtLibraryWidget.h"
 #include "adapters/qt/QtDisplayWidget.h"
+#include "adapters/qt/QtEventLoop.h"
 #include "controller/PlaybackDispatcher.h"
 #include "controller/LibraryDispatcher.h"
 #include "controller/DisplayDispatcher.h"
@@ -19,13 +20,14 @@
 
 int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
+    QtEventLoop event_loop(&app);
 
     const std::string base = std::filesystem::current_path().string();
     QtStyler::apply(app, base + "/resources/styles.qss");
 
     Dice dice;
     RandomAdPolicy ad_policy(dice);
-    MusicPlayer musicPlayer(base + "/resources", ad_policy);
+    MusicPlayer musicPlayer(base + "/resources", ad_policy, event_loop);
 
     QWidget shell;
     shell.setObjectName("MainWindow");
@@ -67,6 +69,8 @@ int main(int argc, char *argv[]) {
     display_events.subscribe(display_bridge);
     library_events.subscribe(library_bridge);
 
+    musicPlayer.attach(event_loop);
+
     shell.show();
     return app.exec();
 }
\ No newline at end of file
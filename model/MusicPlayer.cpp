@@ -3,26 +3,69 @@
 #include "model/repeat/NoRepeatMode.h"
 #include "model/repeat/RepeatOneMode.h"
 #include "model/repeat/RepeatAllMode.h"
+#include <exception>
+#include <map>
 
-MusicPlayer::MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy) : music_library_(basePath + "/music"),
-      playlist_(music_library_), advertisement_(basePath + "/announcements", adPolicy),
-      repeat_mode_(playlist_, notifier_) {
+MusicPlayer::MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy)
+    : MusicPlayer(basePath, adPolicy, nullptr) {
+}
+
+MusicPlayer::MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy, IEventLoop& loop)
+    : MusicPlayer(basePath, adPolicy, &loop) {
+}
+
+MusicPlayer::MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy, IEventLoop* loop)
+    : music_library_(basePath + "/music"), playlist_(music_library_),
+      advertisement_(basePath + "/announcements", adPolicy), repeat_mode_(playlist_, notifier_), loop_(loop) {
 
     repeat_mode_.add(std::make_unique<NoRepeatMode>());
     repeat_mode_.add(std::make_unique<RepeatOneMode>());
     repeat_mode_.add(std::make_unique<RepeatAllMode>());
+    advertisement_.load();
 
-    for (const Song& song : music_library_.load()) {
-        playlist_.add(song);
+    if (loop_) {
+        scanner_ = std::jthread([this] {
+            music_library_.stream([this](const std::vector<Song>& songs) {
+                loop_->post([this, songs] { populate(songs); });
+            });
+            loop_->post([this] {
+                if (!playlist_.hasSelected()) shuffle();
+            });
+        });
+        return;
     }
+    music_library_.stream([this](const std::vector<Song>& songs) {
+        for (const Song& song : songs) {
+            playlist_.add(song);
+        }
+    });
     playlist_.shuffle();
-    advertisement_.load();
+    playlist_.drain();
 }
 
 void MusicPlayer::subscribe(IPlaybackListener& listener) {
     notifier_.add(listener);
 }
 
+void MusicPlayer::attach(IEventLoop& loop) {
+    loop_ = &loop;
+    music_library_.watch([this](const LibraryChange& change) {
+        loop_->post([this, change] { update(change); });
+    });
+}
+
+void MusicPlayer::populate(const std::vector<Song>& songs) {
+    if (playlist_.merge(songs) > 0) {
+        refresh();
+    }
+}
+
+void MusicPlayer::update(const LibraryChange& change) {
+    if (change.apply(playlist_)) {
+        refresh();
+    }
+}
+
 void MusicPlayer::play(const int index) {
     playlist_.select(index, notifier_);
 
@@ -76,9 +119,48 @@ void MusicPlayer::broadcast() {
 }
 
 void MusicPlayer::refresh() {
+    if (batches_ > 0) {
+        stale_ = true;
+        return;
+    }
+    notifier_.onDelta(playlist_.drain());
     notifier_.onChanged();
 }
 
+void MusicPlayer::batch(const std::function<void()>& operations) {
+    const Batch scope(*this);
+    operations();
+}
+
+MusicPlayer::Batch::Batch(MusicPlayer& player) : player_(player), unwinding_(std::uncaught_exceptions()) {
+    player_.batches_++;
+    player_.notifier_.hold();
+}
+
+MusicPlayer::Batch::~Batch() noexcept(false) {
+    if (std::uncaught_exceptions() == unwinding_) {
+        player_.settle();
+        return;
+    }
+    try {
+        player_.settle();
+    } catch (...) {
+    }
+}
+
+void MusicPlayer::settle() {
+    if (--batches_ == 0 && stale_) {
+        stale_ = false;
+        try {
+            refresh();
+        } catch (...) {
+            notifier_.release();
+            throw;
+        }
+    }
+    notifier_.release();
+}
+
 void MusicPlayer::repeat() {
     repeat_mode_.advance();
 }
@@ -93,6 +175,66 @@ void MusicPlayer::insert(const std::string& filePath) {
     notifier_.onFeedback("Song added successfully!", true);
 }
 
+void MusicPlayer::import(const std::string& filePath) {
+    import(std::vector{filePath});
+}
+
+void MusicPlayer::import(const std::vector<std::string>& filePaths) {
+    std::vector<std::string> problems;
+    if (!loop_) {
+        std::vector<Song> songs;
+        for (const auto& transfer : music_library_.admit(filePaths, problems)) {
+            if (std::optional<Song> song = music_library_.import(transfer)) {
+                songs.push_back(std::move(*song));
+            } else {
+                problems.emplace_back("Could not import this song.");
+            }
+        }
+        commit(songs, problems);
+        return;
+    }
+
+    const std::vector<std::string> sources = MusicLibrary::screen(filePaths, problems);
+    if (sources.empty()) {
+        commit({}, problems);
+        return;
+    }
+    music_library_.enqueue(sources,
+        [this](const std::string& name, const int percent) {
+            loop_->post([this, name, percent] { notifier_.onProgress(name, percent); });
+        },
+        [this, problems](const std::vector<std::string>& committed, const std::vector<std::string>& rejected,
+                         const int failed) mutable {
+            problems.insert(problems.end(), rejected.begin(), rejected.end());
+            problems.insert(problems.end(), failed, "Could not import this song.");
+            loop_->post([this, committed, problems] { commit(MusicLibrary::describe(committed), problems); });
+        });
+}
+
+void MusicPlayer::commit(const std::vector<Song>& songs, const std::vector<std::string>& problems) {
+    if (playlist_.merge(songs) > 0) {
+        refresh();
+    }
+    notifier_.onFeedback(summarize(songs.size(), problems), problems.empty());
+}
+
+std::string MusicPlayer::summarize(const std::size_t added, const std::vector<std::string>& problems) {
+    if (problems.empty()) {
+        return added == 1 ? "Song added successfully!" : std::to_string(added) + " songs added successfully!";
+    }
+    if (added == 0 && problems.size() == 1) return problems.front();
+
+    std::map<std::string, int> counts;
+    for (const auto& problem : problems) {
+        counts[problem]++;
+    }
+    std::string summary = "Added " + std::to_string(added) + " of " + std::to_string(added + problems.size()) + " songs.";
+    for (const auto& [problem, count] : counts) {
+        summary += "\n" + problem + " (" + std::to_string(count) + ")";
+    }
+    return summary;
+}
+
 void MusicPlayer::remove(const int index) {
     playlist_.remove(index);
     refresh();
@@ -103,8 +245,8 @@ void MusicPlayer::shuffle() {
     refresh();
 }
 
-void MusicPlayer::sort(ISortingAlgorithm& criteria) {
-    playlist_.sort(criteria);
+void MusicPlayer::sort(ISortingAlgorithm& criteria, const bool descending) {
+    playlist_.sort(criteria, descending);
     refresh();
 }
 
@@ -124,4 +266,12 @@ void MusicPlayer::accept(IPlaylistVisitor& visitor) const {
 
 void MusicPlayer::search(const std::string& query, IPlaylistVisitor& visitor) const {
     playlist_.search(query, visitor);
+}
+
+std::span<const Song> MusicPlayer::songs() const {
+    return playlist_.songs();
+}
+
+std::vector<Song> MusicPlayer::find(const std::string& query) const {
+    return playlist_.find(query);
 }
\ No newline at end of file
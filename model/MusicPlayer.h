@@ -8,22 +8,50 @@
 #include "model/repeat/RepeatMode.h"
 #include "model/events/IPlaylistVisitor.h"
 #include "model/ads/IAdPolicy.h"
+#include "model/events/IEventLoop.h"
+#include <functional>
+#include <thread>
 
 class MusicPlayer {
 private:
+    class Batch final {
+    private:
+        MusicPlayer& player_;
+        int unwinding_;
+
+    public:
+        explicit Batch(MusicPlayer& player);
+        ~Batch() noexcept(false);
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+    };
+
     MusicLibrary music_library_;
     Playlist playlist_;
     Advertisement advertisement_;
     PlaybackNotifier notifier_;
     RepeatMode repeat_mode_;
+    IEventLoop* loop_ = nullptr;
+    int batches_ = 0;
+    bool stale_ = false;
+    std::jthread scanner_;
+
+    MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy, IEventLoop* loop);
 
     void broadcast();
     void refresh();
+    void settle();
+    void update(const LibraryChange& change);
+    void populate(const std::vector<Song>& songs);
+    void commit(const std::vector<Song>& songs, const std::vector<std::string>& problems);
+    static std::string summarize(std::size_t added, const std::vector<std::string>& problems);
 
 public:
     MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy);
+    MusicPlayer(const std::string& basePath, IAdPolicy& adPolicy, IEventLoop& loop);
 
     void subscribe(IPlaybackListener& listener);
+    void attach(IEventLoop& loop);
     void play(int index);
     void pick(const std::string& name);
     void advance();
@@ -31,14 +59,19 @@ public:
     void end();
     void skip();
     void repeat();
+    void batch(const std::function<void()>& operations);
     void insert(const std::string& filePath);
+    void import(const std::string& filePath);
+    void import(const std::vector<std::string>& filePaths);
     void remove(int index);
     void shuffle();
-    void sort(ISortingAlgorithm& criteria);
+    void sort(ISortingAlgorithm& criteria, bool descending = false);
     void reverse();
     void restore();
     void accept(IPlaylistVisitor& visitor) const;
     void search(const std::string& query, IPlaylistVisitor& visitor) const;
+    std::span<const Song> songs() const;
+    std::vector<Song> find(const std::string& query) const;
 };
 
 #endif //MUSIC_PLAYER_H
\ No newline at end of file
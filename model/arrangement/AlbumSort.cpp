@@ -0,0 +1,24 @@
+#include "model/arrangement/AlbumSort.h"
+#include "model/core/FileMetadata.h"
+#include <algorithm>
+#include <cctype>
+
+void AlbumSort::visit(const std::string& name, const std::string& path) {
+    const TagReader::Tags tags = FileMetadata(path).tags();
+    std::string key;
+    key.reserve(kPrefix * 3 + 2);
+    append(key, tags.artist);
+    append(key, tags.album);
+    key.push_back(static_cast<char>(tags.track >> 8));
+    key.push_back(static_cast<char>(tags.track));
+    append(key, tags.title.empty() ? Song::parse(name) : std::string_view(tags.title));
+    keys_.push_back(std::move(key));
+}
+
+void AlbumSort::append(std::string& key, const std::string_view field) {
+    const std::size_t length = std::min(field.size(), kPrefix);
+    for (std::size_t i = 0; i < length; i++) {
+        key.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(field[i]))));
+    }
+    key.append(kPrefix - length, '\0');
+}
@@ -0,0 +1,16 @@
+#ifndef ALBUM_SORT_H
+#define ALBUM_SORT_H
+
+#include "model/arrangement/RadixSort.h"
+#include <string>
+#include <string_view>
+
+class AlbumSort final : public RadixSort {
+private:
+    static constexpr std::size_t kPrefix = 16;
+
+    void visit(const std::string& name, const std::string& path) override;
+    static void append(std::string& key, std::string_view field);
+};
+
+#endif //ALBUM_SORT_H
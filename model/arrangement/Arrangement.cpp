@@ -1,24 +1,95 @@
 #include "model/arrangement/Arrangement.h"
 #include <algorithm>
+#include <numeric>
+#include <unordered_map>
 
-void Arrangement::sort(std::vector<Song>& songs, ISortingAlgorithm& criteria) {
+void Arrangement::sort(std::vector<Song>& songs, ISortingAlgorithm& criteria, const std::uint64_t generation,
+                       const bool descending) {
     preserve(songs);
-    criteria.sort(songs);
+    if (!criteria.recall(songs, generation)) {
+        criteria.sort(songs);
+        criteria.retain(generation);
+    }
+    if (descending) std::ranges::reverse(songs);
+    criteria_ = &criteria;
+    descending_ = descending;
+    synced_ = true;
 }
 
 void Arrangement::reverse(std::vector<Song>& songs) {
     preserve(songs);
     std::ranges::reverse(songs);
+    descending_ = !descending_;
 }
 
 void Arrangement::restore(std::vector<Song>& songs) {
+    detach();
     if (original_.empty()) return;
-    songs = original_;
+
+    std::unordered_map<std::uint64_t, std::size_t> ranks;
+    ranks.reserve(original_.size());
+    for (std::size_t i = 0; i < original_.size(); i++) {
+        ranks.try_emplace(original_[i], i);
+    }
+
+    std::vector<std::size_t> order(songs.size());
+    for (std::size_t i = 0; i < songs.size(); i++) {
+        const auto found = ranks.find(songs[i].id());
+        order[i] = found == ranks.end() ? original_.size() + i : found->second;
+    }
+
+    std::vector<std::size_t> indices(songs.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::ranges::stable_sort(indices, {}, [&](const std::size_t index) { return order[index]; });
+    permute(songs, indices);
     original_.clear();
 }
 
+std::size_t Arrangement::place(const std::vector<Song>& songs, const Song& song, const std::uint64_t generation) {
+    if (!criteria_) return songs.size();
+    const std::size_t rank = criteria_->place(song);
+    if (synced_) criteria_->retain(generation);
+    return descending_ ? songs.size() - rank : rank;
+}
+
+void Arrangement::discard(const std::size_t index, const std::size_t size, const std::uint64_t generation) {
+    if (!criteria_) return;
+    criteria_->discard(descending_ ? size - 1 - index : index);
+    if (synced_) criteria_->retain(generation);
+}
+
+void Arrangement::detach() {
+    criteria_ = nullptr;
+    descending_ = false;
+    synced_ = false;
+}
+
+void Arrangement::invalidate() {
+    synced_ = false;
+}
+
 void Arrangement::preserve(const std::vector<Song>& songs) {
     if (original_.empty()) {
-        original_ = songs;
+        original_.reserve(songs.size());
+        for (const Song& song : songs) {
+            original_.push_back(song.id());
+        }
     }
-}
\ No newline at end of file
+}
+
+void Arrangement::permute(std::vector<Song>& songs, std::vector<std::size_t>& indices) {
+    for (std::size_t start = 0; start < indices.size(); start++) {
+        if (indices[start] == start) continue;
+
+        Song held = std::move(songs[start]);
+        std::size_t current = start;
+        while (indices[current] != start) {
+            const std::size_t next = indices[current];
+            songs[current] = std::move(songs[next]);
+            indices[current] = current;
+            current = next;
+        }
+        songs[current] = std::move(held);
+        indices[current] = current;
+    }
+}
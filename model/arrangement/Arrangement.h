@@ -3,19 +3,28 @@
 
 #include "model/core/Song.h"
 #include "model/arrangement/ISortingAlgorithm.h"
+#include <cstdint>
 #include <vector>
 
 class Arrangement {
 private:
-    std::vector<Song> original_;
+    std::vector<std::uint64_t> original_;
+    ISortingAlgorithm* criteria_ = nullptr;
+    bool descending_ = false;
+    bool synced_ = false;
 
 public:
-    void sort(std::vector<Song>& songs, ISortingAlgorithm& criteria);
+    void sort(std::vector<Song>& songs, ISortingAlgorithm& criteria, std::uint64_t generation, bool descending);
     void reverse(std::vector<Song>& songs);
     void restore(std::vector<Song>& songs);
+    std::size_t place(const std::vector<Song>& songs, const Song& song, std::uint64_t generation);
+    void discard(std::size_t index, std::size_t size, std::uint64_t generation);
+    void detach();
+    void invalidate();
 
 private:
     void preserve(const std::vector<Song>& songs);
+    static void permute(std::vector<Song>& songs, std::vector<std::size_t>& indices);
 };
 
-#endif //ARRANGEMENT_H
\ No newline at end of file
+#endif //ARRANGEMENT_H
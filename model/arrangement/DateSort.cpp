@@ -2,5 +2,5 @@
 #include "model/core/FileMetadata.h"
 
 void DateSort::visit(const std::string&, const std::string& path) {
-    key_ = FileMetadata(path).stamp();
+    keys_.push_back(FileMetadata(path).stamp());
 }
\ No newline at end of file
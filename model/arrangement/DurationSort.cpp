@@ -2,5 +2,5 @@
 #include "model/core/FileMetadata.h"
 
 void DurationSort::visit(const std::string&, const std::string& path) {
-    key_ = FileMetadata(path).last();
+    keys_.push_back(FileMetadata(path).duration());
 }
\ No newline at end of file
@@ -2,12 +2,17 @@
 #define SORTING_ALGORITHM_H
 
 #include "model/core/Song.h"
+#include <cstdint>
 #include <vector>
 
 class ISortingAlgorithm {
 public:
     virtual ~ISortingAlgorithm() = default;
     virtual void sort(std::vector<Song>& songs) = 0;
+    virtual bool recall(std::vector<Song>& songs, std::uint64_t generation) = 0;
+    virtual void retain(std::uint64_t generation) = 0;
+    virtual std::size_t place(const Song& song) = 0;
+    virtual void discard(std::size_t position) = 0;
 };
 
 #endif //SORTING_ALGORITHM_H
\ No newline at end of file
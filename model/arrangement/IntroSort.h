@@ -0,0 +1,83 @@
+#ifndef INTRO_SORT_H
+#define INTRO_SORT_H
+
+#include "model/arrangement/KeyedSort.h"
+#include <algorithm>
+#include <bit>
+#include <thread>
+#include <tuple>
+
+template <typename Key>
+class IntroSort : public KeyedSort<Key> {
+protected:
+    static constexpr std::ptrdiff_t kSerial = 1 << 14;
+    static constexpr std::ptrdiff_t kInsertion = 16;
+
+    void order(std::vector<int>& indices) const override {
+        const std::size_t size = indices.size();
+        const int depth = 2 * std::bit_width(size);
+        const int spawns = size >= kSerial ? std::bit_width(std::max(1u, std::thread::hardware_concurrency())) : 0;
+        introsort(indices.begin(), indices.end(), depth, spawns);
+    }
+
+private:
+    using Iterator = std::vector<int>::iterator;
+
+    bool precedes(const int left, const int right) const {
+        return std::tie(this->keys_[left], left) < std::tie(this->keys_[right], right);
+    }
+
+    void introsort(Iterator first, Iterator last, int depth, const int spawns) const {
+        while (last - first > kInsertion) {
+            if (depth-- == 0) {
+                const auto less = [this](const int left, const int right) { return precedes(left, right); };
+                std::make_heap(first, last, less);
+                std::sort_heap(first, last, less);
+                return;
+            }
+
+            const Iterator pivot = partition(first, last);
+            if (spawns > 0 && last - first >= kSerial) {
+                std::jthread lower([=, this] { introsort(first, pivot, depth, spawns - 1); });
+                introsort(pivot + 1, last, depth, spawns - 1);
+                return;
+            }
+            if (pivot - first < last - pivot) {
+                introsort(first, pivot, depth, spawns);
+                first = pivot + 1;
+            } else {
+                introsort(pivot + 1, last, depth, spawns);
+                last = pivot;
+            }
+        }
+        insert(first, last);
+    }
+
+    Iterator partition(const Iterator first, const Iterator last) const {
+        const Iterator middle = first + (last - first) / 2;
+        const Iterator back = last - 1;
+        if (precedes(*middle, *first)) std::iter_swap(middle, first);
+        if (precedes(*back, *first)) std::iter_swap(back, first);
+        if (precedes(*middle, *back)) std::iter_swap(middle, back);
+
+        const int pivot = *back;
+        const Iterator boundary = std::partition(first, back, [this, pivot](const int index) {
+            return precedes(index, pivot);
+        });
+        std::iter_swap(boundary, back);
+        return boundary;
+    }
+
+    void insert(const Iterator first, const Iterator last) const {
+        for (Iterator current = first; current != last; ++current) {
+            const int index = *current;
+            Iterator hole = current;
+            for (; hole != first && precedes(index, *(hole - 1)); --hole) {
+                *hole = *(hole - 1);
+            }
+            *hole = index;
+        }
+    }
+};
+
+#endif //INTRO_SORT_H
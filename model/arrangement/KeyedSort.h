@@ -0,0 +1,101 @@
+#ifndef KEYED_SORT_H
+#define KEYED_SORT_H
+
+#include "model/arrangement/ISortingAlgorithm.h"
+#include "model/events/IPlaylistVisitor.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+template <typename Key>
+class KeyedSort : public ISortingAlgorithm, public IPlaylistVisitor {
+protected:
+    std::vector<Key> keys_;
+
+    virtual void order(std::vector<int>& indices) const = 0;
+
+    virtual void extract(const Song& song) {
+        song.accept(*this);
+    }
+
+private:
+    static constexpr std::uint64_t kStale = ~0ULL;
+
+    std::vector<std::uint64_t> ids_;
+    std::uint64_t generation_ = kStale;
+
+public:
+    void sort(std::vector<Song>& songs) override {
+        keys_.clear();
+        keys_.reserve(songs.size());
+        for (const Song& song : songs) {
+            extract(song);
+        }
+
+        std::vector<int> indices(songs.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        order(indices);
+        permute(songs, indices);
+        permute(keys_, indices);
+
+        ids_.clear();
+        ids_.reserve(songs.size());
+        for (const Song& song : songs) {
+            ids_.push_back(song.id());
+        }
+        generation_ = kStale;
+    }
+
+    bool recall(std::vector<Song>& songs, const std::uint64_t generation) override {
+        if (generation != generation_ || ids_.size() != songs.size()) return false;
+
+        std::unordered_map<std::uint64_t, int> positions;
+        positions.reserve(songs.size());
+        for (std::size_t i = 0; i < songs.size(); i++) {
+            if (!positions.try_emplace(songs[i].id(), static_cast<int>(i)).second) return false;
+        }
+        std::vector<int> indices;
+        indices.reserve(ids_.size());
+        for (const std::uint64_t id : ids_) {
+            const auto found = positions.find(id);
+            if (found == positions.end()) return false;
+            indices.push_back(found->second);
+        }
+        permute(songs, indices);
+        return true;
+    }
+
+    void retain(const std::uint64_t generation) override {
+        generation_ = generation;
+    }
+
+    std::size_t place(const Song& song) override {
+        extract(song);
+        Key key = std::move(keys_.back());
+        keys_.pop_back();
+        const auto found = std::upper_bound(keys_.begin(), keys_.end(), key);
+        const std::size_t position = found - keys_.begin();
+        keys_.insert(found, std::move(key));
+        ids_.insert(ids_.begin() + std::min(position, ids_.size()), song.id());
+        return position;
+    }
+
+    void discard(const std::size_t position) override {
+        if (position < keys_.size()) keys_.erase(keys_.begin() + position);
+        if (position < ids_.size()) ids_.erase(ids_.begin() + position);
+    }
+
+private:
+    template <typename Item>
+    static void permute(std::vector<Item>& items, const std::vector<int>& indices) {
+        std::vector<Item> arranged;
+        arranged.reserve(items.size());
+        for (const int index : indices) {
+            arranged.push_back(std::move(items[index]));
+        }
+        items = std::move(arranged);
+    }
+};
+
+#endif //KEYED_SORT_H
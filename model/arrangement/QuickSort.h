@@ -1,19 +1,13 @@
 #ifndef QUICK_SORT_H
 #define QUICK_SORT_H
 
-#include "model/arrangement/ISortingAlgorithm.h"
-#include "model/events/IPlaylistVisitor.h"
-#include <utility>
+#include "model/arrangement/IntroSort.h"
+#include <string>
 
-class QuickSort final : public ISortingAlgorithm, public IPlaylistVisitor {
+class QuickSort final : public IntroSort<std::string> {
 private:
-    std::string title_;
-
+    void extract(const Song& song) override;
     void visit(const std::string& name, const std::string& path) override;
-    int divide(std::vector<Song>& songs, const std::pair<int, int>& bounds);
-
-public:
-    void sort(std::vector<Song>& songs) override;
 };
 
-#endif //QUICK_SORT_H
\ No newline at end of file
+#endif //QUICK_SORT_H
@@ -0,0 +1,32 @@
+#include "model/arrangement/RadixSort.h"
+#include <algorithm>
+#include <array>
+
+void RadixSort::order(std::vector<int>& indices) const {
+    std::size_t width = 0;
+    for (const auto& key : keys_) {
+        width = std::max(width, key.size());
+    }
+
+    std::vector<int> buffer(indices.size());
+    std::array<std::size_t, 258> counts {};
+    for (std::size_t position = width; position-- > 0;) {
+        counts.fill(0);
+        const auto bucket = [&](const int index) -> std::size_t {
+            const std::string& key = keys_[index];
+            return position < key.size() ? static_cast<unsigned char>(key[position]) + 1 : 0;
+        };
+        for (const int index : indices) {
+            counts[bucket(index) + 1]++;
+        }
+        if (std::ranges::count(counts, indices.size()) == 1) continue;
+
+        for (std::size_t i = 1; i < counts.size(); i++) {
+            counts[i] += counts[i - 1];
+        }
+        for (const int index : indices) {
+            buffer[counts[bucket(index)]++] = index;
+        }
+        indices.swap(buffer);
+    }
+}
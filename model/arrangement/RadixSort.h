@@ -0,0 +1,12 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include "model/arrangement/KeyedSort.h"
+#include <string>
+
+class RadixSort : public KeyedSort<std::string> {
+protected:
+    void order(std::vector<int>& indices) const override;
+};
+
+#endif //RADIX_SORT_H
@@ -1,19 +1,17 @@
 #include "model/arrangement/ShellSort.h"
 
-void ShellSort::sort(std::vector<Song>& songs) {
-    const int total = songs.size();
+void ShellSort::order(std::vector<int>& indices) const {
+    const int total = static_cast<int>(indices.size());
     for (int interval = total / 2; interval > 0; interval /= 2) {
         for (int i = interval; i < total; i++) {
-            Song swapValue = songs[i];
-            swapValue.accept(*this);
-            const long long swapKey = key_;
+            const int swapIndex = indices[i];
+            const long long swapKey = keys_[swapIndex];
             int j;
             for (j = i; j >= interval; j -= interval) {
-                songs[j - interval].accept(*this);
-                if (key_ <= swapKey) break;
-                songs[j] = songs[j - interval];
+                if (keys_[indices[j - interval]] <= swapKey) break;
+                indices[j] = indices[j - interval];
             }
-            songs[j] = swapValue;
+            indices[j] = swapIndex;
         }
     }
-}
\ No newline at end of file
+}
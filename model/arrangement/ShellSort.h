@@ -1,15 +1,11 @@
 #ifndef SHELL_SORT_H
 #define SHELL_SORT_H
 
-#include "model/arrangement/ISortingAlgorithm.h"
-#include "model/events/IPlaylistVisitor.h"
+#include "model/arrangement/KeyedSort.h"
 
-class ShellSort : public ISortingAlgorithm, public IPlaylistVisitor {
+class ShellSort : public KeyedSort<long long> {
 protected:
-    long long key_ = 0;
-
-public:
-    void sort(std::vector<Song>& songs) override;
+    void order(std::vector<int>& indices) const override;
 };
 
 #endif //SHELL_SORT_H
@@ -0,0 +1,167 @@
+#include "model/core/AudioProbe.h"
+#include <algorithm>
+#include <cstring>
+
+int AudioProbe::measure(const std::string& path) {
+    const MappedFile file(path);
+    if (!file.isOpen() || file.size() == 0) return 0;
+
+    long long duration = measureWave(file);
+    if (duration < 0) duration = measureMpeg(file);
+    if (duration < 0) duration = file.size() * 8 * 1000 / kNominalRate;
+    return static_cast<int>(std::min<long long>(duration, INT32_MAX));
+}
+
+long long AudioProbe::measureWave(const MappedFile& file) {
+    const MappedWindow head = file.map(0, kHead);
+    const auto bytes = head.bytes();
+    if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 ||
+        std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) return -1;
+
+    long long byteRate = 0;
+    long long offset = 12;
+    while (offset + 8 <= file.size()) {
+        const MappedWindow header = file.map(offset, 20);
+        const auto chunk = header.bytes();
+        if (chunk.size() < 8) break;
+        const long long length = littleEndian(chunk.subspan(4, 4));
+
+        if (std::memcmp(chunk.data(), "fmt ", 4) == 0 && chunk.size() >= 20) {
+            byteRate = littleEndian(chunk.subspan(16, 4));
+        } else if (std::memcmp(chunk.data(), "data", 4) == 0) {
+            const long long available = std::min(length, file.size() - offset - 8);
+            return byteRate > 0 ? available * 1000 / byteRate : -1;
+        }
+        offset += 8 + length + (length & 1);
+    }
+    return -1;
+}
+
+long long AudioProbe::measureMpeg(const MappedFile& file) {
+    const long long start = skipTag(file);
+    const MappedWindow window = file.map(start, kHead);
+    const auto head = window.bytes();
+    const int found = locate(head);
+    if (found < 0) return -1;
+
+    const auto frame = head.subspan(found);
+    const int version = (frame[1] >> 3) & 3;
+    const bool mono = (frame[3] >> 6) == 3;
+    const long long frames = countFrames(frame, version, mono);
+    if (frames > 0) {
+        return frames * samplesPerFrame(frame) * 1000 / sampleRate(frame);
+    }
+    return walkFrames(frame, file.size() - start - found - trailer(file));
+}
+
+long long AudioProbe::countFrames(const std::span<const std::uint8_t> frame, const int version, const bool mono) {
+    const std::size_t side = version == 3 ? (mono ? 17 : 32) : (mono ? 9 : 17);
+    const std::size_t xing = 4 + side;
+    if (frame.size() >= xing + 12 &&
+        (std::memcmp(frame.data() + xing, "Xing", 4) == 0 || std::memcmp(frame.data() + xing, "Info", 4) == 0) &&
+        (bigEndian(frame.subspan(xing + 4, 4)) & 1) != 0) {
+        return bigEndian(frame.subspan(xing + 8, 4));
+    }
+
+    constexpr std::size_t vbri = 4 + 32;
+    if (frame.size() >= vbri + 18 && std::memcmp(frame.data() + vbri, "VBRI", 4) == 0) {
+        return bigEndian(frame.subspan(vbri + 14, 4));
+    }
+    return 0;
+}
+
+long long AudioProbe::walkFrames(const std::span<const std::uint8_t> head, const long long audioBytes) {
+    long long frames = 0;
+    long long bits = 0;
+    std::size_t offset = 0;
+    while (offset + 4 <= head.size() && isFrame(head.subspan(offset, 4))) {
+        const auto header = head.subspan(offset, 4);
+        bits += static_cast<long long>(bitrate(header));
+        frames++;
+        offset += frameLength(header);
+    }
+    if (frames == 0) return -1;
+    return audioBytes * 8 * 1000 / (bits / frames);
+}
+
+long long AudioProbe::skipTag(const MappedFile& file) {
+    const MappedWindow window = file.map(0, 10);
+    const auto tag = window.bytes();
+    if (tag.size() < 10 || std::memcmp(tag.data(), "ID3", 3) != 0) return 0;
+
+    const long long length = (tag[6] & 0x7F) << 21 | (tag[7] & 0x7F) << 14 | (tag[8] & 0x7F) << 7 | (tag[9] & 0x7F);
+    const long long footer = (tag[5] & 0x10) != 0 ? 10 : 0;
+    return 10 + length + footer;
+}
+
+long long AudioProbe::trailer(const MappedFile& file) {
+    if (file.size() < kTail) return 0;
+    const MappedWindow window = file.map(file.size() - kTail, kTail);
+    const auto tail = window.bytes();
+    return tail.size() == kTail && std::memcmp(tail.data(), "TAG", 3) == 0 ? kTail : 0;
+}
+
+int AudioProbe::locate(const std::span<const std::uint8_t> head) {
+    for (std::size_t offset = 0; offset + 4 <= head.size(); offset++) {
+        if (!isFrame(head.subspan(offset, 4))) continue;
+        const std::size_t next = offset + frameLength(head.subspan(offset, 4));
+        if (next + 4 > head.size() || isFrame(head.subspan(next, 4))) {
+            return static_cast<int>(offset);
+        }
+    }
+    return -1;
+}
+
+bool AudioProbe::isFrame(const std::span<const std::uint8_t> header) {
+    if (header[0] != 0xFF || (header[1] & 0xE0) != 0xE0) return false;
+    const int version = (header[1] >> 3) & 3;
+    const int layer = (header[1] >> 1) & 3;
+    const int rate = header[2] >> 4;
+    const int frequency = (header[2] >> 2) & 3;
+    return version != 1 && layer != 0 && rate != 0 && rate != 15 && frequency != 3;
+}
+
+int AudioProbe::bitrate(const std::span<const std::uint8_t> header) {
+    static constexpr int kRates[5][15] = {
+        {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448},
+        {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384},
+        {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},
+        {0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256},
+        {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},
+    };
+    const bool first = ((header[1] >> 3) & 3) == 3;
+    const int layer = 4 - ((header[1] >> 1) & 3);
+    const int table = first ? layer - 1 : (layer == 1 ? 3 : 4);
+    return kRates[table][header[2] >> 4] * 1000;
+}
+
+int AudioProbe::sampleRate(const std::span<const std::uint8_t> header) {
+    static constexpr int kRates[3] = {44100, 48000, 32000};
+    const int version = (header[1] >> 3) & 3;
+    const int divisor = version == 3 ? 1 : (version == 2 ? 2 : 4);
+    return kRates[(header[2] >> 2) & 3] / divisor;
+}
+
+int AudioProbe::samplesPerFrame(const std::span<const std::uint8_t> header) {
+    const int layer = 4 - ((header[1] >> 1) & 3);
+    if (layer == 1) return 384;
+    if (layer == 3 && ((header[1] >> 3) & 3) != 3) return 576;
+    return 1152;
+}
+
+int AudioProbe::frameLength(const std::span<const std::uint8_t> header) {
+    const int padding = (header[2] >> 1) & 1;
+    const int layer = 4 - ((header[1] >> 1) & 3);
+    if (layer == 1) {
+        return (12 * bitrate(header) / sampleRate(header) + padding) * 4;
+    }
+    return samplesPerFrame(header) / 8 * bitrate(header) / sampleRate(header) + padding;
+}
+
+std::uint32_t AudioProbe::bigEndian(const std::span<const std::uint8_t> bytes) {
+    return static_cast<std::uint32_t>(bytes[0]) << 24 | bytes[1] << 16 | bytes[2] << 8 | bytes[3];
+}
+
+std::uint32_t AudioProbe::littleEndian(const std::span<const std::uint8_t> bytes) {
+    return static_cast<std::uint32_t>(bytes[3]) << 24 | bytes[2] << 16 | bytes[1] << 8 | bytes[0];
+}
@@ -0,0 +1,34 @@
+#ifndef AUDIO_PROBE_H
+#define AUDIO_PROBE_H
+
+#include "model/core/MappedFile.h"
+#include <cstdint>
+#include <span>
+#include <string>
+
+class AudioProbe {
+private:
+    static constexpr long long kHead = 16 * 1024;
+    static constexpr long long kTail = 128;
+    static constexpr long long kNominalRate = 128000;
+
+    static long long measureWave(const MappedFile& file);
+    static long long measureMpeg(const MappedFile& file);
+    static long long countFrames(std::span<const std::uint8_t> frame, int version, bool mono);
+    static long long walkFrames(std::span<const std::uint8_t> head, long long audioBytes);
+    static long long skipTag(const MappedFile& file);
+    static long long trailer(const MappedFile& file);
+    static int locate(std::span<const std::uint8_t> head);
+    static int frameLength(std::span<const std::uint8_t> header);
+    static int bitrate(std::span<const std::uint8_t> header);
+    static int sampleRate(std::span<const std::uint8_t> header);
+    static int samplesPerFrame(std::span<const std::uint8_t> header);
+    static bool isFrame(std::span<const std::uint8_t> header);
+    static std::uint32_t bigEndian(std::span<const std::uint8_t> bytes);
+    static std::uint32_t littleEndian(std::span<const std::uint8_t> bytes);
+
+public:
+    static int measure(const std::string& path);
+};
+
+#endif //AUDIO_PROBE_H
@@ -0,0 +1,48 @@
+#include "model/core/Collation.h"
+#include <algorithm>
+
+std::string Collation::key(const std::string_view text) {
+    std::string key;
+    key.reserve(text.size() + 4);
+    for (std::size_t i = 0; i < text.size();) {
+        const auto current = static_cast<unsigned char>(text[i]);
+        if (current >= '0' && current <= '9') {
+            std::size_t end = i;
+            while (end < text.size() && text[end] >= '0' && text[end] <= '9') end++;
+            number(key, text.substr(i, end - i));
+            i = end;
+        } else if (current == ' ' || current == '\t') {
+            while (i < text.size() && (text[i] == ' ' || text[i] == '\t')) i++;
+            key.push_back(' ');
+        } else if (current >= 'A' && current <= 'Z') {
+            key.push_back(static_cast<char>(current - 'A' + 'a'));
+            i++;
+        } else if (i + 1 < text.size() && fold(current, text[i + 1])) {
+            key.append(fold(current, text[i + 1]));
+            i += 2;
+        } else {
+            key.push_back(static_cast<char>(current));
+            i++;
+        }
+    }
+    return key;
+}
+
+void Collation::number(std::string& key, std::string_view digits) {
+    const std::size_t significant = digits.find_first_not_of('0');
+    digits = significant == std::string_view::npos ? digits.substr(digits.size() - 1) : digits.substr(significant);
+    key.push_back('0');
+    key.push_back(static_cast<char>(std::min<std::size_t>(digits.size(), 0xFF)));
+    key.append(digits);
+}
+
+const char* Collation::fold(const unsigned char lead, const unsigned char trail) {
+    static constexpr const char* kLatin[64] = {
+        "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+        "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "ss",
+        "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",
+        "d", "n", "o", "o", "o", "o", "o", nullptr, "o", "u", "u", "u", "u", "y", "th", "y"
+    };
+    if (lead != 0xC3 || trail < 0x80 || trail > 0xBF) return nullptr;
+    return kLatin[trail - 0x80];
+}
@@ -0,0 +1,16 @@
+#ifndef COLLATION_H
+#define COLLATION_H
+
+#include <string>
+#include <string_view>
+
+class Collation {
+public:
+    static std::string key(std::string_view text);
+
+private:
+    static void number(std::string& key, std::string_view digits);
+    static const char* fold(unsigned char lead, unsigned char trail);
+};
+
+#endif //COLLATION_H
@@ -1,19 +1,20 @@
 #include "model/core/FileMetadata.h"
-#include <filesystem>
 
-FileMetadata::FileMetadata(const std::string& path) : path_(path) {}
-
-bool FileMetadata::exists() const {
-    return std::filesystem::exists(path_);
-}
+FileMetadata::FileMetadata(const std::string& path, const MetadataCache& cache)
+    : path_(path), cache_(cache) {}
 
 long long FileMetadata::stamp() const {
-    if (!exists()) return 0;
-    const auto time = std::filesystem::last_write_time(path_);
-    return time.time_since_epoch().count();
+    return cache_.stamp(path_);
 }
 
 int FileMetadata::last() const {
-    if (!exists()) return 0;
-    return static_cast<int>(std::filesystem::file_size(path_));
-}
\ No newline at end of file
+    return static_cast<int>(cache_.size(path_));
+}
+
+int FileMetadata::duration() const {
+    return cache_.duration(path_);
+}
+
+TagReader::Tags FileMetadata::tags() const {
+    return cache_.tags(path_);
+}
@@ -1,18 +1,20 @@
 #ifndef FILE_METADATA_H
 #define FILE_METADATA_H
 
+#include "model/core/MetadataCache.h"
 #include <string>
 
 class FileMetadata {
 private:
     std::string path_;
-
-    bool exists() const;
+    const MetadataCache& cache_;
 
 public:
-    explicit FileMetadata(const std::string& path);
+    explicit FileMetadata(const std::string& path, const MetadataCache& cache = MetadataCache::shared());
     long long stamp() const;
     int last() const;
+    int duration() const;
+    TagReader::Tags tags() const;
 };
 
-#endif //FILE_METADATA_H
\ No newline at end of file
+#endif //FILE_METADATA_H
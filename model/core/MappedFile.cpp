@@ -0,0 +1,30 @@
+#include "model/core/MappedFile.h"
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+
+MappedFile::MappedFile(const std::string& path)
+    : descriptor_(::open(path.c_str(), O_RDONLY | O_CLOEXEC)) {
+    struct stat status {};
+    if (descriptor_ >= 0 && ::fstat(descriptor_, &status) == 0) {
+        size_ = status.st_size;
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (descriptor_ >= 0) ::close(descriptor_);
+}
+
+bool MappedFile::isOpen() const {
+    return descriptor_ >= 0;
+}
+
+long long MappedFile::size() const {
+    return size_;
+}
+
+MappedWindow MappedFile::map(const long long offset, const long long length) const {
+    const long long clamped = std::clamp(size_ - offset, 0LL, length);
+    return {descriptor_, offset, static_cast<std::size_t>(clamped)};
+}
@@ -0,0 +1,23 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include "model/core/MappedWindow.h"
+#include <string>
+
+class MappedFile {
+private:
+    int descriptor_ = -1;
+    long long size_ = 0;
+
+public:
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    bool isOpen() const;
+    long long size() const;
+    MappedWindow map(long long offset, long long length) const;
+};
+
+#endif //MAPPED_FILE_H
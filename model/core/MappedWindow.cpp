@@ -0,0 +1,25 @@
+#include "model/core/MappedWindow.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+MappedWindow::MappedWindow(const int descriptor, const long long offset, const std::size_t length) {
+    if (descriptor < 0 || offset < 0 || length == 0) return;
+
+    const long long page = sysconf(_SC_PAGESIZE);
+    const long long aligned = offset - offset % page;
+    const std::size_t slack = static_cast<std::size_t>(offset - aligned);
+    void* base = ::mmap(nullptr, length + slack, PROT_READ, MAP_PRIVATE, descriptor, aligned);
+    if (base == MAP_FAILED) return;
+
+    base_ = base;
+    mapped_ = length + slack;
+    bytes_ = {static_cast<const std::uint8_t*>(base) + slack, length};
+}
+
+MappedWindow::~MappedWindow() {
+    if (base_) ::munmap(base_, mapped_);
+}
+
+std::span<const std::uint8_t> MappedWindow::bytes() const {
+    return bytes_;
+}
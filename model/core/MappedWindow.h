@@ -0,0 +1,23 @@
+#ifndef MAPPED_WINDOW_H
+#define MAPPED_WINDOW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+class MappedWindow {
+private:
+    void* base_ = nullptr;
+    std::size_t mapped_ = 0;
+    std::span<const std::uint8_t> bytes_;
+
+public:
+    MappedWindow(int descriptor, long long offset, std::size_t length);
+    MappedWindow(const MappedWindow&) = delete;
+    MappedWindow& operator=(const MappedWindow&) = delete;
+    ~MappedWindow();
+
+    std::span<const std::uint8_t> bytes() const;
+};
+
+#endif //MAPPED_WINDOW_H
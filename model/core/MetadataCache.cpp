@@ -0,0 +1,248 @@
+#include "model/core/MetadataCache.h"
+#include "model/core/AudioProbe.h"
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+MetadataCache& MetadataCache::shared() {
+    static MetadataCache cache;
+    return cache;
+}
+
+void MetadataCache::fill(const std::vector<std::string>& paths) {
+    std::vector<std::string> missing;
+    std::vector<Entry> found;
+    {
+        std::lock_guard lock(mutex_);
+        for (const std::string& path : paths) {
+            const auto known = entries_.find(path);
+            if (known == entries_.end()) {
+                missing.push_back(path);
+                found.emplace_back();
+            } else if (known->second.restored) {
+                missing.push_back(path);
+                found.push_back(known->second);
+            }
+        }
+    }
+    if (missing.empty()) return;
+
+    std::vector<TagReader::Tags> tags(missing.size());
+    std::vector<char> present(missing.size());
+    const std::size_t workers = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, missing.size());
+    {
+        std::vector<std::jthread> pool;
+        for (std::size_t worker = 0; worker < workers; worker++) {
+            pool.emplace_back([&, worker] {
+                for (std::size_t i = worker; i < missing.size(); i += workers) {
+                    present[i] = verify(missing[i], found[i], tags[i]);
+                }
+            });
+        }
+    }
+
+    std::lock_guard lock(mutex_);
+    entries_.reserve(entries_.size() + missing.size());
+    for (std::size_t i = 0; i < missing.size(); i++) {
+        if (present[i] == kConfirmed) {
+            if (const auto known = entries_.find(missing[i]); known != entries_.end()) known->second.restored = false;
+        } else if (present[i] == kInspected) {
+            annotate(found[i], tags[i]);
+            entries_.insert_or_assign(std::move(missing[i]), found[i]);
+        } else {
+            entries_.erase(missing[i]);
+        }
+    }
+}
+
+bool MetadataCache::refresh(const std::string& path) {
+    Entry entry;
+    TagReader::Tags tags;
+    const bool present = inspect(path, entry, tags);
+    std::lock_guard lock(mutex_);
+    if (!present) return entries_.erase(path) > 0;
+
+    annotate(entry, tags);
+    const auto found = entries_.find(path);
+    if (found != entries_.end() && found->second == entry) return false;
+    entries_.insert_or_assign(path, entry);
+    return true;
+}
+
+void MetadataCache::forget(const std::string& path) {
+    std::lock_guard lock(mutex_);
+    entries_.erase(path);
+}
+
+long long MetadataCache::stamp(const std::string& path) const {
+    return lookup(path).stamp;
+}
+
+long long MetadataCache::size(const std::string& path) const {
+    return lookup(path).size;
+}
+
+int MetadataCache::duration(const std::string& path) const {
+    {
+        std::lock_guard lock(mutex_);
+        if (const auto found = entries_.find(path); found != entries_.end()) {
+            return found->second.duration;
+        }
+    }
+    return AudioProbe::measure(path);
+}
+
+TagReader::Tags MetadataCache::tags(const std::string& path) const {
+    {
+        std::lock_guard lock(mutex_);
+        if (const auto found = entries_.find(path); found != entries_.end()) {
+            const Entry& entry = found->second;
+            return {labels_[entry.title], labels_[entry.artist], labels_[entry.album], entry.track, entry.year};
+        }
+    }
+    return TagReader::read(path);
+}
+
+MetadataCache::Entry MetadataCache::lookup(const std::string& path) const {
+    {
+        std::lock_guard lock(mutex_);
+        if (const auto found = entries_.find(path); found != entries_.end()) {
+            return found->second;
+        }
+    }
+    Entry entry;
+    probe(path, entry);
+    return entry;
+}
+
+void MetadataCache::save(const std::string& file, const std::string& directory) const {
+    std::ofstream output(file, std::ios::trunc);
+    if (!output) return;
+
+    std::lock_guard lock(mutex_);
+    for (const auto& [path, entry] : entries_) {
+        if (isWithin(path, directory)) {
+            output << entry.stamp << ' ' << entry.size << ' ' << entry.duration << ' ' << entry.track << ' '
+                   << entry.year << ' ' << labels_[entry.title] << '\t' << labels_[entry.artist] << '\t'
+                   << labels_[entry.album] << '\t' << escape(path) << '\n';
+        }
+    }
+}
+
+void MetadataCache::restore(const std::string& file, const std::string& directory) {
+    Entry listing;
+    restore(file, directory, probe(directory, listing) ? listing.stamp : 0);
+}
+
+void MetadataCache::restore(const std::string& file, const std::string& directory, const long long modified) {
+    std::lock_guard lock(mutex_);
+    discard(directory);
+    if (!isFresh(file, modified)) return;
+
+    std::ifstream input(file);
+    Entry entry;
+    TagReader::Tags tags;
+    std::string line;
+    while (input >> entry.stamp >> entry.size >> entry.duration >> tags.track >> tags.year &&
+           input.get() == ' ' && std::getline(input, line)) {
+        std::istringstream fields(line);
+        std::string path;
+        if (!std::getline(fields, tags.title, '\t') || !std::getline(fields, tags.artist, '\t') ||
+            !std::getline(fields, tags.album, '\t') || !std::getline(fields, path)) continue;
+        path = unescape(path);
+        if (isWithin(path, directory)) {
+            entry.restored = true;
+            annotate(entry, tags);
+            entries_.insert_or_assign(path, entry);
+        }
+    }
+}
+
+void MetadataCache::discard(const std::string& directory) {
+    std::erase_if(entries_, [&](const auto& item) {
+        return isWithin(item.first, directory);
+    });
+}
+
+void MetadataCache::annotate(Entry& entry, const TagReader::Tags& tags) {
+    entry.title = label(tags.title);
+    entry.artist = label(tags.artist);
+    entry.album = label(tags.album);
+    entry.track = static_cast<std::uint16_t>(std::clamp(tags.track, 0, 0xFFFF));
+    entry.year = static_cast<std::uint16_t>(std::clamp(tags.year, 0, 0xFFFF));
+}
+
+std::uint32_t MetadataCache::label(const std::string& text) {
+    if (text.empty()) return 0;
+    const auto [found, inserted] = label_ids_.try_emplace(text, static_cast<std::uint32_t>(labels_.size()));
+    if (inserted) labels_.push_back(text);
+    return found->second;
+}
+
+bool MetadataCache::probe(const std::string& path, Entry& entry) {
+    struct stat status {};
+    if (::stat(path.c_str(), &status) != 0) return false;
+    entry.stamp = status.st_mtim.tv_sec * 1'000'000'000LL + status.st_mtim.tv_nsec;
+    entry.size = status.st_size;
+    return true;
+}
+
+bool MetadataCache::inspect(const std::string& path, Entry& entry, TagReader::Tags& tags) {
+    if (!probe(path, entry)) return false;
+    entry.duration = AudioProbe::measure(path);
+    tags = TagReader::read(path);
+    return true;
+}
+
+char MetadataCache::verify(const std::string& path, Entry& entry, TagReader::Tags& tags) {
+    if (entry.restored) {
+        Entry current;
+        if (!probe(path, current)) return kAbsent;
+        if (current.stamp == entry.stamp && current.size == entry.size) return kConfirmed;
+        entry = Entry();
+    }
+    return inspect(path, entry, tags) ? kInspected : kAbsent;
+}
+
+bool MetadataCache::isFresh(const std::string& file, const long long modified) {
+    Entry saved;
+    return probe(file, saved) && modified <= saved.stamp;
+}
+
+bool MetadataCache::isWithin(const std::string& path, const std::string& directory) {
+    return path.size() > directory.size() && path.starts_with(directory) && path[directory.size()] == '/';
+}
+
+std::string MetadataCache::escape(const std::string& text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        if (c == '\\') {
+            escaped += "\\\\";
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else if (c == '\t') {
+            escaped += "\\t";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string MetadataCache::unescape(const std::string& text) {
+    std::string plain;
+    plain.reserve(text.size());
+    for (std::size_t i = 0; i < text.size(); i++) {
+        if (text[i] != '\\' || i + 1 == text.size()) {
+            plain += text[i];
+            continue;
+        }
+        const char next = text[++i];
+        plain += next == 'n' ? '\n' : next == 't' ? '\t' : next;
+    }
+    return plain;
+}
@@ -0,0 +1,63 @@
+#ifndef METADATA_CACHE_H
+#define METADATA_CACHE_H
+
+#include "model/core/TagReader.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+class MetadataCache {
+private:
+    struct Entry {
+        long long stamp = 0;
+        long long size = 0;
+        int duration = 0;
+        std::uint32_t title = 0;
+        std::uint32_t artist = 0;
+        std::uint32_t album = 0;
+        std::uint16_t track = 0;
+        std::uint16_t year = 0;
+        bool restored = false;
+
+        bool operator==(const Entry&) const = default;
+    };
+
+    static constexpr char kAbsent = 0;
+    static constexpr char kInspected = 1;
+    static constexpr char kConfirmed = 2;
+
+    std::unordered_map<std::string, Entry> entries_;
+    std::vector<std::string> labels_{""};
+    std::unordered_map<std::string, std::uint32_t> label_ids_;
+    mutable std::mutex mutex_;
+
+    Entry lookup(const std::string& path) const;
+    void discard(const std::string& directory);
+    void annotate(Entry& entry, const TagReader::Tags& tags);
+    std::uint32_t label(const std::string& text);
+    static bool probe(const std::string& path, Entry& entry);
+    static bool inspect(const std::string& path, Entry& entry, TagReader::Tags& tags);
+    static char verify(const std::string& path, Entry& entry, TagReader::Tags& tags);
+    static bool isFresh(const std::string& file, long long modified);
+    static bool isWithin(const std::string& path, const std::string& directory);
+    static std::string escape(const std::string& text);
+    static std::string unescape(const std::string& text);
+
+public:
+    static MetadataCache& shared();
+
+    void fill(const std::vector<std::string>& paths);
+    bool refresh(const std::string& path);
+    void forget(const std::string& path);
+    long long stamp(const std::string& path) const;
+    long long size(const std::string& path) const;
+    int duration(const std::string& path) const;
+    TagReader::Tags tags(const std::string& path) const;
+    void save(const std::string& file, const std::string& directory) const;
+    void restore(const std::string& file, const std::string& directory);
+    void restore(const std::string& file, const std::string& directory, long long modified);
+};
+
+#endif //METADATA_CACHE_H
@@ -2,17 +2,39 @@
 #include <random>
 #include <algorithm>
 #include <ranges>
+#include <utility>
 
 Playlist::Playlist(IPlaylistVisitor& deleter) : deleter_(deleter) {}
 
 void Playlist::add(const Song& song) {
-    songs_.push_back(song);
+    const int position = static_cast<int>(arrangement_.place(songs_, song, ++generation_));
+    songs_.insert(songs_.begin() + position, song);
+    delta_.insert(position);
+    if (position + 1 < static_cast<int>(songs_.size())) {
+        mapped_ = false;
+        if (position <= current_song_) current_song_++;
+    } else if (copies_.contains(song.id())) {
+        mapped_ = false;
+    } else if (mapped_) {
+        positions_.try_emplace(song.id(), position);
+        repeats_.push_back(-1);
+    }
+    retain(song);
 }
 
 void Playlist::remove(const int index) {
-    if (index < 0 || index >= songs_.size()) return;
+    if (index < 0 || index >= static_cast<int>(songs_.size())) return;
     songs_[index].accept(deleter_);
+    release(songs_[index]);
+    arrangement_.discard(index, songs_.size(), ++generation_);
+    if (index + 1 < static_cast<int>(songs_.size()) || copies_.contains(songs_[index].id())) {
+        mapped_ = false;
+    } else if (mapped_) {
+        positions_.erase(songs_[index].id());
+        repeats_.pop_back();
+    }
     songs_.erase(songs_.begin() + index);
+    delta_.remove(index);
 
     if (index == current_song_) {
         current_song_ = -1;
@@ -21,8 +43,63 @@ void Playlist::remove(const int index) {
     }
 }
 
-void Playlist::sort(ISortingAlgorithm& criteria) {
-    rearrange([&] { arrangement_.sort(songs_, criteria); });
+std::size_t Playlist::merge(const std::vector<Song>& songs) {
+    const std::size_t before = songs_.size();
+    for (const Song& song : songs) {
+        if (!copies_.contains(song.id())) add(song);
+    }
+    return songs_.size() - before;
+}
+
+std::size_t Playlist::prune(const std::function<bool(const Song&)>& predicate) {
+    const std::uint64_t current = hasSelected() ? songs_[current_song_].id() : 0;
+    const bool selected = hasSelected();
+    std::vector<char> doomed(songs_.size());
+    std::size_t erased = 0;
+    for (std::size_t i = 0; i < songs_.size(); i++) {
+        doomed[i] = predicate(songs_[i]);
+        erased += doomed[i];
+    }
+    if (erased == 0) return 0;
+
+    generation_++;
+    std::size_t remaining = songs_.size();
+    for (std::size_t i = songs_.size(); i-- > 0;) {
+        if (!doomed[i]) continue;
+        release(songs_[i]);
+        arrangement_.discard(i, remaining--, generation_);
+        delta_.remove(i);
+    }
+    std::size_t next = 0;
+    std::erase_if(songs_, [&](const Song&) { return doomed[next++] != 0; });
+
+    mapped_ = false;
+    if (selected) locate(current);
+    return erased;
+}
+
+std::size_t Playlist::revise(const std::vector<Song>& songs) {
+    const auto revised = std::ranges::count_if(songs, [this](const Song& song) { return copies_.contains(song.id()); });
+    if (revised == 0) return 0;
+
+    generation_++;
+    arrangement_.invalidate();
+    return static_cast<std::size_t>(revised);
+}
+
+void Playlist::retain(const Song& song) {
+    if (copies_[song.id()]++ == 0) song.enroll(index_);
+}
+
+void Playlist::release(const Song& song) {
+    const auto entry = copies_.find(song.id());
+    if (entry == copies_.end() || --entry->second > 0) return;
+    song.withdraw(index_);
+    copies_.erase(entry);
+}
+
+void Playlist::sort(ISortingAlgorithm& criteria, const bool descending) {
+    rearrange([&] { arrangement_.sort(songs_, criteria, generation_, descending); });
 }
 
 void Playlist::reverse() {
@@ -34,29 +111,47 @@ void Playlist::restore() {
 }
 
 void Playlist::rearrange(const std::function<void()>& operation) {
+    const std::vector<Song> before = songs_;
     if (!hasSelected()) {
         operation();
+        mapped_ = false;
+        track(before);
         return;
     }
-    const Song current = songs_[current_song_];
+    const std::uint64_t current = songs_[current_song_].id();
     operation();
+    mapped_ = false;
     locate(current);
+    track(before);
+}
+
+void Playlist::locate(const std::uint64_t id) {
+    map();
+    const auto entry = positions_.find(id);
+    current_song_ = entry == positions_.end() ? -1 : entry->second;
 }
 
-void Playlist::locate(const Song& target) {
-    for (int i = 0; i < songs_.size(); i++) {
-        if (songs_[i].isEqualTo(target)) {
-            current_song_ = i;
-            return;
+void Playlist::map() const {
+    if (mapped_) return;
+    mapped_ = true;
+    positions_.clear();
+    positions_.reserve(copies_.size());
+    repeats_.assign(songs_.size(), -1);
+    for (int i = static_cast<int>(songs_.size()); i-- > 0;) {
+        const auto [entry, inserted] = positions_.try_emplace(songs_[i].id(), i);
+        if (!inserted) {
+            repeats_[i] = entry->second;
+            entry->second = i;
         }
     }
-    current_song_ = -1;
 }
 
 void Playlist::shuffle() {
     static std::random_device rd;
     static std::mt19937 generator(rd());
 
+    const std::vector<Song> before = songs_;
+    arrangement_.detach();
     if (hasSelected()) {
         std::swap(songs_[0], songs_[current_song_]);
         std::shuffle(songs_.begin() + 1, songs_.end(), generator);
@@ -64,27 +159,79 @@ void Playlist::shuffle() {
     } else {
         std::ranges::shuffle(songs_, generator);
     }
+    mapped_ = false;
+    track(before);
+}
+
+void Playlist::track(const std::vector<Song>& before) {
+    constexpr std::size_t kNone = ~std::size_t{0};
+    std::unordered_map<std::uint64_t, std::size_t> heads;
+    heads.reserve(before.size());
+    std::vector<std::size_t> next(before.size(), kNone);
+    for (std::size_t i = before.size(); i-- > 0;) {
+        const auto [entry, inserted] = heads.try_emplace(before[i].id(), i);
+        if (!inserted) {
+            next[i] = entry->second;
+            entry->second = i;
+        }
+    }
+
+    std::vector<std::size_t> order;
+    order.reserve(songs_.size());
+    for (const Song& song : songs_) {
+        std::size_t& head = heads.at(song.id());
+        order.push_back(head);
+        head = next[head];
+    }
+    delta_.move(std::move(order));
 }
 
 void Playlist::clear() {
+    generation_++;
+    delta_.remove(0, songs_.size());
+    arrangement_.detach();
     songs_.clear();
+    index_.clear();
+    copies_.clear();
+    positions_.clear();
+    repeats_.clear();
+    mapped_ = true;
     current_song_ = -1;
 }
 
 void Playlist::select(const int index, IPlaybackListener& listener) {
-    if (index >= 0 && index < songs_.size()) {
+    if (index >= 0 && index < static_cast<int>(songs_.size())) {
         current_song_ = index;
         notify(listener);
     }
 }
 
 void Playlist::pick(const std::string& name, IPlaybackListener& listener) {
-    for (int i = 0; i < songs_.size(); i++) {
-        if (songs_[i].matches(name)) {
-            select(i, listener);
-            return;
+    if (!index_.covers(name)) {
+        for (int i = 0; i < static_cast<int>(songs_.size()); i++) {
+            if (songs_[i].matches(name)) {
+                select(i, listener);
+                return;
+            }
+        }
+        return;
+    }
+    const std::vector<int> positions = lookup(name);
+    if (!positions.empty()) select(positions.front(), listener);
+}
+
+std::vector<int> Playlist::lookup(const std::string& query) const {
+    map();
+    std::vector<int> positions;
+    for (const std::uint64_t id : index_.candidates(query)) {
+        int position = positions_.at(id);
+        if (!songs_[position].matches(query)) continue;
+        for (; position >= 0; position = repeats_[position]) {
+            positions.push_back(position);
         }
     }
+    std::ranges::sort(positions);
+    return positions;
 }
 
 void Playlist::advance(IPlaybackListener& listener) {
@@ -112,17 +259,35 @@ void Playlist::play(IPlaylistVisitor& player) const {
 }
 
 void Playlist::accept(IPlaylistVisitor& visitor) const {
-    for (const Song& song : songs_) {
+    for (const Song& song : songs()) {
         song.accept(visitor);
     }
 }
 
 void Playlist::search(const std::string& query, IPlaylistVisitor& visitor) const {
-    for (const Song& song : songs_) {
-        if (song.matches(query)) {
-            song.accept(visitor);
+    for (const Song& song : find(query)) {
+        song.accept(visitor);
+    }
+}
+
+std::span<const Song> Playlist::songs() const {
+    return songs_;
+}
+
+std::vector<Song> Playlist::find(const std::string& query) const {
+    std::vector<Song> found;
+    if (!index_.covers(query)) {
+        for (const Song& song : songs_) {
+            if (song.matches(query)) found.push_back(song);
         }
+        return found;
+    }
+    const std::vector<int> positions = lookup(query);
+    found.reserve(positions.size());
+    for (const int position : positions) {
+        found.push_back(songs_[position]);
     }
+    return found;
 }
 
 bool Playlist::hasNext() const {
@@ -131,4 +296,8 @@ bool Playlist::hasNext() const {
 
 bool Playlist::hasSelected() const {
     return current_song_ >= 0 && current_song_ < static_cast<int>(songs_.size());
+}
+
+PlaylistDelta Playlist::drain() {
+    return std::exchange(delta_, {});
 }
\ No newline at end of file
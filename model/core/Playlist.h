@@ -2,26 +2,40 @@
 #define PLAYLIST_H
 
 #include "model/core/Song.h"
+#include "model/core/SearchIndex.h"
 #include "model/arrangement/ISortingAlgorithm.h"
 #include "model/events/IPlaylistVisitor.h"
 #include "model/events/IPlaybackListener.h"
 #include "model/arrangement/Arrangement.h"
+#include "model/events/PlaylistDelta.h"
+#include <span>
 #include <vector>
 #include <functional>
+#include <unordered_map>
 
 class Playlist {
 private:
     std::vector<Song> songs_;
     Arrangement arrangement_;
+    SearchIndex index_;
+    std::unordered_map<std::uint64_t, int> copies_;
+    mutable std::unordered_map<std::uint64_t, int> positions_;
+    mutable std::vector<int> repeats_;
+    mutable bool mapped_ = true;
     IPlaylistVisitor& deleter_;
     int current_song_ = -1;
+    std::uint64_t generation_ = 0;
+    PlaylistDelta delta_;
 
 public:
     explicit Playlist(IPlaylistVisitor& deleter);
 
     void add(const Song& song);
     void remove(int index);
-    void sort(ISortingAlgorithm& criteria);
+    std::size_t merge(const std::vector<Song>& songs);
+    std::size_t prune(const std::function<bool(const Song&)>& predicate);
+    std::size_t revise(const std::vector<Song>& songs);
+    void sort(ISortingAlgorithm& criteria, bool descending = false);
     void reverse();
     void restore();
     void shuffle();
@@ -33,12 +47,20 @@ public:
     void play(IPlaylistVisitor& player) const;
     void accept(IPlaylistVisitor& visitor) const;
     void search(const std::string& query, IPlaylistVisitor& visitor) const;
+    std::span<const Song> songs() const;
+    std::vector<Song> find(const std::string& query) const;
     bool hasNext() const;
     bool hasSelected() const;
+    PlaylistDelta drain();
 
 private:
     void rearrange(const std::function<void()>& operation);
-    void locate(const Song& target);
+    void locate(std::uint64_t id);
+    void map() const;
+    void track(const std::vector<Song>& before);
+    void retain(const Song& song);
+    void release(const Song& song);
+    std::vector<int> lookup(const std::string& query) const;
     void notify(IPlaybackListener& listener) const;
 };
 
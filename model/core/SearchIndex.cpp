@@ -0,0 +1,69 @@
+#include "model/core/SearchIndex.h"
+#include <algorithm>
+
+void SearchIndex::add(const std::uint64_t key, const std::string_view text) {
+    for (const std::uint32_t trigram : trigrams(text)) {
+        auto& posting = postings_[trigram];
+        if (posting.empty() || posting.back() < key) {
+            posting.push_back(key);
+        } else {
+            const auto position = std::ranges::lower_bound(posting, key);
+            if (position == posting.end() || *position != key) posting.insert(position, key);
+        }
+    }
+}
+
+void SearchIndex::remove(const std::uint64_t key, const std::string_view text) {
+    for (const std::uint32_t trigram : trigrams(text)) {
+        const auto found = postings_.find(trigram);
+        if (found == postings_.end()) continue;
+
+        auto& posting = found->second;
+        const auto position = std::ranges::lower_bound(posting, key);
+        if (position != posting.end() && *position == key) posting.erase(position);
+        if (posting.empty()) postings_.erase(found);
+    }
+}
+
+void SearchIndex::clear() {
+    postings_.clear();
+}
+
+bool SearchIndex::covers(const std::string_view query) const {
+    return query.size() >= 3;
+}
+
+std::vector<std::uint64_t> SearchIndex::candidates(const std::string_view query) const {
+    std::vector<const std::vector<std::uint64_t>*> lists;
+    for (const std::uint32_t trigram : trigrams(query)) {
+        const auto found = postings_.find(trigram);
+        if (found == postings_.end()) return {};
+        lists.push_back(&found->second);
+    }
+    if (lists.empty()) return {};
+    std::ranges::sort(lists, {}, [](const auto* posting) { return posting->size(); });
+
+    std::vector<std::uint64_t> result = *lists.front();
+    std::vector<std::uint64_t> narrowed;
+    for (std::size_t i = 1; i < lists.size() && !result.empty(); i++) {
+        narrowed.clear();
+        std::ranges::set_intersection(result, *lists[i], std::back_inserter(narrowed));
+        result.swap(narrowed);
+    }
+    return result;
+}
+
+std::vector<std::uint32_t> SearchIndex::trigrams(const std::string_view text) {
+    std::vector<std::uint32_t> result;
+    if (text.size() < 3) return result;
+
+    result.reserve(text.size() - 2);
+    for (std::size_t i = 0; i + 2 < text.size(); i++) {
+        result.push_back(static_cast<std::uint8_t>(text[i]) << 16 |
+                         static_cast<std::uint8_t>(text[i + 1]) << 8 |
+                         static_cast<std::uint8_t>(text[i + 2]));
+    }
+    std::ranges::sort(result);
+    result.erase(std::ranges::unique(result).begin(), result.end());
+    return result;
+}
@@ -0,0 +1,23 @@
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class SearchIndex {
+private:
+    std::unordered_map<std::uint32_t, std::vector<std::uint64_t>> postings_;
+
+    static std::vector<std::uint32_t> trigrams(std::string_view text);
+
+public:
+    void add(std::uint64_t key, std::string_view text);
+    void remove(std::uint64_t key, std::string_view text);
+    void clear();
+    bool covers(std::string_view query) const;
+    std::vector<std::uint64_t> candidates(std::string_view query) const;
+};
+
+#endif //SEARCH_INDEX_H
@@ -1,34 +1,65 @@
 #include "model/core/Song.h"
-#include <regex>
+#include "model/core/SongCatalog.h"
 
 Song::Song(const std::string& name, const std::string& path)
-       : name_(name), path_(path) {
+       : id_(SongCatalog::shared().intern(name, path)) {
+}
+
+std::uint64_t Song::id() const {
+    return id_;
+}
+
+std::string_view Song::name() const {
+    return SongCatalog::shared().name(id_);
+}
+
+std::string Song::path() const {
+    return SongCatalog::shared().path(id_);
+}
+
+std::string_view Song::collation() const {
+    return SongCatalog::shared().collation(id_);
 }
 
 void Song::accept(IPlaylistVisitor& visitor) const {
-    visitor.visit(name_, path_);
+    visitor.visit(std::string(name()), path());
+}
+
+void Song::enroll(SearchIndex& index) const {
+    index.add(id_, SongCatalog::shared().name(id_));
+}
+
+void Song::withdraw(SearchIndex& index) const {
+    index.remove(id_, SongCatalog::shared().name(id_));
 }
 
 bool Song::matches(const std::string& query) const {
-    return name_.find(query) != std::string::npos;
+    return SongCatalog::shared().name(id_).find(query) != std::string_view::npos;
+}
+
+bool Song::isWithin(const std::string& path) const {
+    return SongCatalog::shared().isWithin(id_, path);
 }
 
 bool Song::isEqualTo(const Song& other) const {
-    return name_ == other.name_ && path_ == other.path_;
+    return id_ == other.id_;
 }
 
-std::string Song::parse(const std::string& name) {
-    static const std::regex pattern(R"(\(\d+\)\s(.+))");
-    std::smatch match;
-    if (std::regex_match(name, match, pattern)) {
-        return trim(match[1]);
-    }
-    return trim(name);
+std::string_view Song::parse(const std::string_view name) {
+    if (!name.starts_with('(')) return trim(name);
+
+    const std::size_t close = name.find_first_not_of("0123456789", 1);
+    if (close == 1 || close == std::string_view::npos || name[close] != ')') return trim(name);
+    if (close + 2 >= name.size() || !std::string_view(" \t\n\v\f\r").contains(name[close + 1])) return trim(name);
+
+    const std::string_view title = name.substr(close + 2);
+    if (title.find_first_of("\n\r") != std::string_view::npos) return trim(name);
+    return trim(title);
 }
 
-std::string Song::trim(const std::string& string) {
-    const size_t first = string.find_first_not_of(" \t\n\r");
-    if (first == std::string::npos) return "";
-    const size_t last = string.find_last_not_of(" \t\n\r");
-    return string.substr(first, last - first + 1);
+std::string_view Song::trim(const std::string_view text) {
+    const size_t first = text.find_first_not_of(" \t\n\r");
+    if (first == std::string_view::npos) return {};
+    const size_t last = text.find_last_not_of(" \t\n\r");
+    return text.substr(first, last - first + 1);
 }
\ No newline at end of file
@@ -2,22 +2,31 @@
 #define SONG_H
 
 #include "model/events/IPlaylistVisitor.h"
+#include "model/core/SearchIndex.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 class Song {
 private:
-    std::string name_;
-    std::string path_;
+    std::uint64_t id_;
 
-    static std::string trim(const std::string& string);
+    static std::string_view trim(std::string_view text);
 
 public:
     Song(const std::string& name, const std::string& path);
 
+    std::uint64_t id() const;
+    std::string_view name() const;
+    std::string path() const;
+    std::string_view collation() const;
     void accept(IPlaylistVisitor& visitor) const;
+    void enroll(SearchIndex& index) const;
+    void withdraw(SearchIndex& index) const;
     bool matches(const std::string& query) const;
+    bool isWithin(const std::string& path) const;
     bool isEqualTo(const Song& other) const;
-    static std::string parse(const std::string& name);
+    static std::string_view parse(std::string_view name);
 };
 
-#endif //SONG_H
\ No newline at end of file
+#endif //SONG_H
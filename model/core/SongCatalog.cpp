@@ -0,0 +1,123 @@
+#include "model/core/SongCatalog.h"
+#include "model/core/Collation.h"
+#include "model/core/Song.h"
+#include <algorithm>
+#include <cstring>
+
+SongCatalog& SongCatalog::shared() {
+    static SongCatalog catalog;
+    return catalog;
+}
+
+std::uint64_t SongCatalog::intern(const std::string_view name, const std::string_view path) {
+    const std::size_t split = path.rfind('/') + 1;
+    const std::string_view directory = path.substr(0, split);
+    const std::string_view leaf = path.substr(split);
+    const std::lock_guard lock(mutex_);
+    const std::uint32_t owner = folder(directory);
+    const std::size_t key = hash(owner, name, leaf);
+
+    const auto [first, last] = lookup_.equal_range(key);
+    for (auto entry = first; entry != last; ++entry) {
+        if (holds(entry->second, owner, name, leaf)) return entry->second;
+    }
+
+    Record record;
+    record.name = store(name);
+    record.leaf = leaf == name ? record.name : store(leaf);
+    const std::string collation = Collation::key(Song::parse(name));
+    record.collation = collation == name ? record.name : store(collation);
+    record.folder = owner;
+
+    const auto id = static_cast<std::uint32_t>(records_.size());
+    records_.push_back(record);
+    lookup_.emplace(key, id);
+    return id;
+}
+
+std::string_view SongCatalog::name(const std::uint64_t id) const {
+    const std::lock_guard lock(mutex_);
+    return view(records_[id].name);
+}
+
+std::string_view SongCatalog::collation(const std::uint64_t id) const {
+    const std::lock_guard lock(mutex_);
+    return view(records_[id].collation);
+}
+
+std::string SongCatalog::path(const std::uint64_t id) const {
+    const std::lock_guard lock(mutex_);
+    const Record& record = records_[id];
+    const std::string_view directory = view(folders_[record.folder]);
+    const std::string_view leaf = view(record.leaf);
+
+    std::string result;
+    result.reserve(directory.size() + leaf.size());
+    result.append(directory).append(leaf);
+    return result;
+}
+
+bool SongCatalog::isWithin(const std::uint64_t id, std::string_view path) const {
+    while (path.size() > 1 && path.back() == '/') path.remove_suffix(1);
+    const std::lock_guard lock(mutex_);
+    const Record& record = records_[id];
+    const std::string_view directory = view(folders_[record.folder]);
+    const std::string_view leaf = view(record.leaf);
+    if (path.size() > directory.size() + leaf.size()) return false;
+
+    const std::size_t head = std::min(path.size(), directory.size());
+    if (directory.substr(0, head) != path.substr(0, head)) return false;
+    if (path.size() > directory.size() && !leaf.starts_with(path.substr(directory.size()))) return false;
+    if (path.size() == directory.size() + leaf.size()) return true;
+
+    const char next = path.size() < directory.size() ? directory[path.size()] : leaf[path.size() - directory.size()];
+    return next == '/';
+}
+
+std::size_t SongCatalog::size() const {
+    const std::lock_guard lock(mutex_);
+    return records_.size();
+}
+
+std::size_t SongCatalog::footprint() const {
+    const std::lock_guard lock(mutex_);
+    return allocated_ + records_.capacity() * sizeof(Record) + folders_.capacity() * sizeof(Text);
+}
+
+SongCatalog::Text SongCatalog::store(const std::string_view text) {
+    if (text.empty()) return {};
+    if (used_ + text.size() > kChunk) {
+        const std::size_t capacity = std::max(kChunk, text.size());
+        chunks_.push_back(std::make_unique_for_overwrite<char[]>(capacity));
+        allocated_ += capacity;
+        used_ = 0;
+    }
+    const auto chunk = static_cast<std::uint32_t>(chunks_.size() - 1);
+    const Text result{chunk << kChunkBits | static_cast<std::uint32_t>(used_), static_cast<std::uint32_t>(text.size())};
+    std::memcpy(chunks_.back().get() + used_, text.data(), text.size());
+    used_ += text.size();
+    return result;
+}
+
+std::string_view SongCatalog::view(const Text text) const {
+    if (text.length == 0) return {};
+    return {chunks_[text.offset >> kChunkBits].get() + (text.offset & (kChunk - 1)), text.length};
+}
+
+std::uint32_t SongCatalog::folder(const std::string_view directory) {
+    const auto [entry, inserted] = folder_ids_.try_emplace(std::string(directory),
+                                                           static_cast<std::uint32_t>(folders_.size()));
+    if (inserted) folders_.push_back(store(directory));
+    return entry->second;
+}
+
+bool SongCatalog::holds(const std::uint32_t id, const std::uint32_t folder, const std::string_view name,
+                        const std::string_view leaf) const {
+    const Record& record = records_[id];
+    return record.folder == folder && view(record.name) == name && view(record.leaf) == leaf;
+}
+
+std::size_t SongCatalog::hash(const std::uint32_t folder, const std::string_view name, const std::string_view leaf) {
+    const std::hash<std::string_view> hasher;
+    return hasher(name) ^ hasher(leaf) * 31 ^ static_cast<std::size_t>(folder) * 0x9e3779b97f4a7c15ULL;
+}
@@ -0,0 +1,56 @@
+#ifndef SONG_CATALOG_H
+#define SONG_CATALOG_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class SongCatalog {
+private:
+    struct Text {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    struct Record {
+        Text name;
+        Text leaf;
+        Text collation;
+        std::uint32_t folder = 0;
+    };
+
+    static constexpr std::uint32_t kChunkBits = 16;
+    static constexpr std::size_t kChunk = std::size_t{1} << kChunkBits;
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    std::size_t used_ = kChunk;
+    std::size_t allocated_ = 0;
+    std::vector<Record> records_;
+    std::vector<Text> folders_;
+    std::unordered_map<std::string, std::uint32_t> folder_ids_;
+    std::unordered_multimap<std::size_t, std::uint32_t> lookup_;
+    mutable std::mutex mutex_;
+
+    Text store(std::string_view text);
+    std::string_view view(Text text) const;
+    std::uint32_t folder(std::string_view directory);
+    bool holds(std::uint32_t id, std::uint32_t folder, std::string_view name, std::string_view leaf) const;
+    static std::size_t hash(std::uint32_t folder, std::string_view name, std::string_view leaf);
+
+public:
+    static SongCatalog& shared();
+
+    std::uint64_t intern(std::string_view name, std::string_view path);
+    std::string_view name(std::uint64_t id) const;
+    std::string_view collation(std::uint64_t id) const;
+    std::string path(std::uint64_t id) const;
+    bool isWithin(std::uint64_t id, std::string_view path) const;
+    std::size_t size() const;
+    std::size_t footprint() const;
+};
+
+#endif //SONG_CATALOG_H
@@ -0,0 +1,240 @@
+#include "model/core/TagReader.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+TagReader::Tags TagReader::read(const std::string& path) {
+    Tags tags;
+    const MappedFile file(path);
+    if (!file.isOpen() || file.size() == 0) return tags;
+
+    readId3v2(file, tags);
+    readInfo(file, tags);
+    readId3v1(file, tags);
+    return tags;
+}
+
+void TagReader::readId3v2(const MappedFile& file, Tags& tags) {
+    const MappedWindow header = file.map(0, kHeader);
+    const auto head = header.bytes();
+    if (head.size() < kHeader || std::memcmp(head.data(), "ID3", 3) != 0) return;
+
+    const int version = head[3];
+    if (version < 2 || version > 4) return;
+    const long long length = std::min<long long>(syncsafe(head.subspan(6, 4)), kLimit);
+    const MappedWindow window = file.map(kHeader, length);
+    auto body = window.bytes();
+    const bool unsynchronised = (head[5] & 0x80) != 0;
+    std::vector<std::uint8_t> restored;
+    if (unsynchronised && version < 4) {
+        restored = resync(body);
+        body = restored;
+    }
+
+    if ((head[5] & 0x40) != 0 && version >= 3 && body.size() >= 4) {
+        const std::size_t extended = version == 4 ? syncsafe(body.first(4)) : bigEndian(body.first(4)) + 4;
+        body = body.subspan(std::min(extended, body.size()));
+    }
+
+    const std::size_t identifier = version == 2 ? 3 : 4;
+    const std::size_t frameHeader = version == 2 ? 6 : 10;
+    while (body.size() >= frameHeader && body[0] != 0) {
+        const std::string_view id(reinterpret_cast<const char*>(body.data()), identifier);
+        std::size_t size;
+        if (version == 2) {
+            size = body[3] << 16 | body[4] << 8 | body[5];
+        } else if (version == 3) {
+            size = bigEndian(body.subspan(4, 4));
+        } else {
+            size = syncsafe(body.subspan(4, 4));
+        }
+        if (size > body.size() - frameHeader) break;
+
+        auto payload = body.subspan(frameHeader, size);
+        const std::uint8_t flags = version == 2 ? 0 : body[9];
+        const bool hidden = version == 3 ? (flags & 0xC0) != 0 : (flags & 0x0C) != 0;
+        if (version == 4 && (flags & 0x01) != 0 && payload.size() >= 4) {
+            payload = payload.subspan(4);
+        }
+        std::vector<std::uint8_t> frame;
+        if (version == 4 && (unsynchronised || (flags & 0x02) != 0)) {
+            frame = resync(payload);
+            payload = frame;
+        }
+        if (!hidden && id[0] == 'T') {
+            assign(id, decode(payload), tags);
+        }
+        body = body.subspan(frameHeader + size);
+    }
+}
+
+void TagReader::readId3v1(const MappedFile& file, Tags& tags) {
+    if (file.size() < kTrailer) return;
+    const MappedWindow window = file.map(file.size() - kTrailer, kTrailer);
+    const auto tail = window.bytes();
+    if (tail.size() < kTrailer || std::memcmp(tail.data(), "TAG", 3) != 0) return;
+
+    assign("TIT2", latin(tail.subspan(3, 30)), tags);
+    assign("TPE1", latin(tail.subspan(33, 30)), tags);
+    assign("TALB", latin(tail.subspan(63, 30)), tags);
+    assign("TYER", latin(tail.subspan(93, 4)), tags);
+    if (tail[125] == 0 && tail[126] != 0) {
+        assign("TRCK", std::to_string(tail[126]), tags);
+    }
+}
+
+void TagReader::readInfo(const MappedFile& file, Tags& tags) {
+    const MappedWindow header = file.map(0, 12);
+    const auto head = header.bytes();
+    if (head.size() < 12 || std::memcmp(head.data(), "RIFF", 4) != 0 ||
+        std::memcmp(head.data() + 8, "WAVE", 4) != 0) return;
+
+    long long offset = 12;
+    while (offset + kChunk <= file.size()) {
+        const MappedWindow window = file.map(offset, kChunk + 4);
+        const auto chunk = window.bytes();
+        if (chunk.size() < kChunk) break;
+        const long long length = littleEndian(chunk.subspan(4, 4));
+
+        if (std::memcmp(chunk.data(), "LIST", 4) == 0 && chunk.size() >= 12 && length >= 4 &&
+            std::memcmp(chunk.data() + 8, "INFO", 4) == 0) {
+            const MappedWindow list = file.map(offset + 12, std::min(length - 4, kLimit));
+            readList(list.bytes(), tags);
+            return;
+        }
+        offset += kChunk + length + (length & 1);
+    }
+}
+
+void TagReader::readList(std::span<const std::uint8_t> list, Tags& tags) {
+    while (list.size() >= kChunk) {
+        const std::string_view id(reinterpret_cast<const char*>(list.data()), 4);
+        const std::size_t length = littleEndian(list.subspan(4, 4));
+        if (length > list.size() - kChunk) break;
+
+        assign(id, plain(list.subspan(kChunk, length)), tags);
+        list = list.subspan(std::min<std::size_t>(list.size(), kChunk + length + (length & 1)));
+    }
+}
+
+void TagReader::assign(const std::string_view field, std::string value, Tags& tags) {
+    value = clean(std::move(value));
+    if (value.empty()) return;
+
+    if (field == "TIT2" || field == "TT2" || field == "INAM") {
+        if (tags.title.empty()) tags.title = std::move(value);
+    } else if (field == "TPE1" || field == "TP1" || field == "IART") {
+        if (tags.artist.empty()) tags.artist = std::move(value);
+    } else if (field == "TALB" || field == "TAL" || field == "IPRD") {
+        if (tags.album.empty()) tags.album = std::move(value);
+    } else if (field == "TRCK" || field == "TRK" || field == "ITRK" || field == "IPRT") {
+        if (tags.track == 0) tags.track = number(value);
+    } else if (field == "TYER" || field == "TYE" || field == "TDRC" || field == "ICRD") {
+        if (tags.year == 0) tags.year = number(value);
+    }
+}
+
+std::string TagReader::decode(const std::span<const std::uint8_t> frame) {
+    if (frame.empty()) return "";
+    const auto text = frame.subspan(1);
+    switch (frame[0]) {
+        case 0: return latin(text);
+        case 1:
+            if (text.size() >= 2 && text[0] == 0xFE && text[1] == 0xFF) return utf16(text.subspan(2), true);
+            if (text.size() >= 2 && text[0] == 0xFF && text[1] == 0xFE) return utf16(text.subspan(2), false);
+            return utf16(text, false);
+        case 2: return utf16(text, true);
+        case 3: return plain(text);
+        default: return "";
+    }
+}
+
+std::vector<std::uint8_t> TagReader::resync(const std::span<const std::uint8_t> bytes) {
+    std::vector<std::uint8_t> restored;
+    restored.reserve(bytes.size());
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        restored.push_back(bytes[i]);
+        if (bytes[i] == 0xFF && i + 1 < bytes.size() && bytes[i + 1] == 0x00) i++;
+    }
+    return restored;
+}
+
+std::string TagReader::latin(const std::span<const std::uint8_t> bytes) {
+    std::string text;
+    text.reserve(bytes.size());
+    for (const std::uint8_t byte : bytes) {
+        if (byte == 0) break;
+        if (byte < 0x80) {
+            text.push_back(static_cast<char>(byte));
+        } else {
+            text.push_back(static_cast<char>(0xC0 | byte >> 6));
+            text.push_back(static_cast<char>(0x80 | (byte & 0x3F)));
+        }
+    }
+    return text;
+}
+
+std::string TagReader::utf16(const std::span<const std::uint8_t> bytes, const bool bigEndian) {
+    std::string text;
+    text.reserve(bytes.size());
+    for (std::size_t i = 0; i + 1 < bytes.size(); i += 2) {
+        std::uint32_t unit = bigEndian ? bytes[i] << 8 | bytes[i + 1] : bytes[i + 1] << 8 | bytes[i];
+        if (unit == 0) break;
+        if (unit >= 0xD800 && unit < 0xDC00 && i + 3 < bytes.size()) {
+            const std::uint32_t low = bigEndian ? bytes[i + 2] << 8 | bytes[i + 3] : bytes[i + 3] << 8 | bytes[i + 2];
+            if (low >= 0xDC00 && low < 0xE000) {
+                unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                i += 2;
+            }
+        }
+        if (unit < 0x80) {
+            text.push_back(static_cast<char>(unit));
+        } else if (unit < 0x800) {
+            text.push_back(static_cast<char>(0xC0 | unit >> 6));
+            text.push_back(static_cast<char>(0x80 | (unit & 0x3F)));
+        } else if (unit < 0x10000) {
+            text.push_back(static_cast<char>(0xE0 | unit >> 12));
+            text.push_back(static_cast<char>(0x80 | (unit >> 6 & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (unit & 0x3F)));
+        } else {
+            text.push_back(static_cast<char>(0xF0 | unit >> 18));
+            text.push_back(static_cast<char>(0x80 | (unit >> 12 & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (unit >> 6 & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (unit & 0x3F)));
+        }
+    }
+    return text;
+}
+
+std::string TagReader::plain(const std::span<const std::uint8_t> bytes) {
+    const auto end = std::ranges::find(bytes, 0);
+    return {bytes.begin(), end};
+}
+
+std::string TagReader::clean(std::string text) {
+    std::ranges::replace_if(text, [](const char c) { return static_cast<unsigned char>(c) < 0x20; }, ' ');
+    const auto first = text.find_first_not_of(' ');
+    if (first == std::string::npos) return "";
+    return text.substr(first, text.find_last_not_of(' ') - first + 1);
+}
+
+int TagReader::number(const std::string_view text) {
+    int value = 0;
+    for (const char c : text) {
+        if (c < '0' || c > '9' || value > 100000) break;
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+std::uint32_t TagReader::syncsafe(const std::span<const std::uint8_t> bytes) {
+    return (bytes[0] & 0x7F) << 21 | (bytes[1] & 0x7F) << 14 | (bytes[2] & 0x7F) << 7 | (bytes[3] & 0x7F);
+}
+
+std::uint32_t TagReader::bigEndian(const std::span<const std::uint8_t> bytes) {
+    return static_cast<std::uint32_t>(bytes[0]) << 24 | bytes[1] << 16 | bytes[2] << 8 | bytes[3];
+}
+
+std::uint32_t TagReader::littleEndian(const std::span<const std::uint8_t> bytes) {
+    return static_cast<std::uint32_t>(bytes[3]) << 24 | bytes[2] << 16 | bytes[1] << 8 | bytes[0];
+}
@@ -0,0 +1,46 @@
+#ifndef TAG_READER_H
+#define TAG_READER_H
+
+#include "model/core/MappedFile.h"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TagReader {
+public:
+    struct Tags {
+        std::string title;
+        std::string artist;
+        std::string album;
+        int track = 0;
+        int year = 0;
+    };
+
+    static Tags read(const std::string& path);
+
+private:
+    static constexpr long long kHeader = 10;
+    static constexpr long long kTrailer = 128;
+    static constexpr long long kChunk = 8;
+    static constexpr long long kLimit = 1024 * 1024;
+
+    static void readId3v2(const MappedFile& file, Tags& tags);
+    static void readId3v1(const MappedFile& file, Tags& tags);
+    static void readInfo(const MappedFile& file, Tags& tags);
+    static void readList(std::span<const std::uint8_t> list, Tags& tags);
+    static void assign(std::string_view field, std::string value, Tags& tags);
+    static std::string decode(std::span<const std::uint8_t> frame);
+    static std::vector<std::uint8_t> resync(std::span<const std::uint8_t> bytes);
+    static std::string latin(std::span<const std::uint8_t> bytes);
+    static std::string utf16(std::span<const std::uint8_t> bytes, bool bigEndian);
+    static std::string plain(std::span<const std::uint8_t> bytes);
+    static std::string clean(std::string text);
+    static int number(std::string_view text);
+    static std::uint32_t syncsafe(std::span<const std::uint8_t> bytes);
+    static std::uint32_t bigEndian(std::span<const std::uint8_t> bytes);
+    static std::uint32_t littleEndian(std::span<const std::uint8_t> bytes);
+};
+
+#endif //TAG_READER_H
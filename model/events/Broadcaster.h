@@ -0,0 +1,24 @@
+#ifndef BROADCASTER_H
+#define BROADCASTER_H
+
+#include <vector>
+
+template <typename Listener>
+class Broadcaster final {
+private:
+    std::vector<Listener*> listeners_;
+
+public:
+    void add(Listener& listener) {
+        listeners_.push_back(&listener);
+    }
+
+    template <auto Event, typename... Args>
+    void notify(const Args&... args) const {
+        for (Listener* listener : listeners_) {
+            (listener->*Event)(args...);
+        }
+    }
+};
+
+#endif //BROADCASTER_H
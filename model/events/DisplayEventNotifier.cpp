@@ -1,27 +1,21 @@
 #include "model/events/DisplayEventNotifier.h"
 
 void DisplayEventNotifier::subscribe(IDisplayEvent& observer) {
-    observers_.push_back(&observer);
-}
-
-void DisplayEventNotifier::notify(const std::function<void(IDisplayEvent*)>& action) const {
-    for (auto* observer : observers_) {
-        action(observer);
-    }
+    observers_.add(observer);
 }
 
 void DisplayEventNotifier::onStart(const std::string&) {}
 
 void DisplayEventNotifier::onChanged() {
-    notify([](IDisplayEvent* observer) {
-        observer->onChanged();
-    });
+    observers_.notify<&IDisplayEvent::onChanged>();
+}
+
+void DisplayEventNotifier::onDelta(const PlaylistDelta& delta) {
+    observers_.notify<&IDisplayEvent::onDelta>(delta);
 }
 
 void DisplayEventNotifier::onSelected(const int index) {
-    notify([&](IDisplayEvent* observer) {
-        observer->onSelected(index);
-    });
+    observers_.notify<&IDisplayEvent::onSelected>(index);
 }
 
 void DisplayEventNotifier::onEnabled(bool) {}
@@ -30,4 +24,5 @@ void DisplayEventNotifier::onSchedule(int) {}
 void DisplayEventNotifier::onCancel() {}
 void DisplayEventNotifier::onRepeatChanged(int) {}
 void DisplayEventNotifier::onFeedback(const std::string&, bool) {}
+void DisplayEventNotifier::onProgress(const std::string&, int) {}
 void DisplayEventNotifier::onStopped() {}
\ No newline at end of file
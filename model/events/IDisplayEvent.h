@@ -1,10 +1,13 @@
 #ifndef I_DISPLAY_EVENT_H
 #define I_DISPLAY_EVENT_H
 
+#include "model/events/PlaylistDelta.h"
+
 class IDisplayEvent {
 public:
     virtual ~IDisplayEvent() = default;
     virtual void onChanged() = 0;
+    virtual void onDelta(const PlaylistDelta& delta) = 0;
     virtual void onSelected(int index) = 0;
 };
 
@@ -0,0 +1,12 @@
+#ifndef I_EVENT_LOOP_H
+#define I_EVENT_LOOP_H
+
+#include <functional>
+
+class IEventLoop {
+public:
+    virtual ~IEventLoop() = default;
+    virtual void post(std::function<void()> task) = 0;
+};
+
+#endif //I_EVENT_LOOP_H
@@ -1,12 +1,15 @@
 #ifndef I_LIBRARY_EVENT_H
 #define I_LIBRARY_EVENT_H
 
+#include <string>
+
 class ILibraryEvent {
 public:
     virtual ~ILibraryEvent() = default;
     virtual void onReveal(bool visible) = 0;
     virtual void onEnabled(bool state) = 0;
     virtual void onSelected(int index) = 0;
+    virtual void onProgress(const std::string& name, int percent) = 0;
 };
 
 #endif //I_LIBRARY_EVENT_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #ifndef I_PLAYBACK_LISTENER_H
 #define I_PLAYBACK_LISTENER_H
+#include "model/events/PlaylistDelta.h"
 #include <string>
 
 class IPlaybackListener {
@@ -7,6 +8,7 @@ public:
     virtual ~IPlaybackListener() = default;
     virtual void onStart(const std::string& path) = 0;
     virtual void onChanged() = 0;
+    virtual void onDelta(const PlaylistDelta& delta) = 0;
     virtual void onSelected(int index) = 0;
     virtual void onEnabled(bool state) = 0;
     virtual void onReveal(bool visible) = 0;
@@ -14,6 +16,7 @@ public:
     virtual void onCancel() = 0;
     virtual void onRepeatChanged(int mode) = 0;
     virtual void onFeedback(const std::string& message, bool success) = 0;
+    virtual void onProgress(const std::string& name, int percent) = 0;
     virtual void onStopped() = 0;
 };
 
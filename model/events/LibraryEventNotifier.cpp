@@ -1,38 +1,32 @@
 #include "model/events/LibraryEventNotifier.h"
 
 void LibraryEventNotifier::subscribe(ILibraryEvent& observer) {
-    observers_.push_back(&observer);
-}
-
-void LibraryEventNotifier::notify(const std::function<void(ILibraryEvent*)>& action) const {
-    for (auto* observer : observers_) {
-        action(observer);
-    }
+    observers_.add(observer);
 }
 
 void LibraryEventNotifier::onStart(const std::string&) {}
 void LibraryEventNotifier::onChanged() {}
+void LibraryEventNotifier::onDelta(const PlaylistDelta&) {}
 
 void LibraryEventNotifier::onSelected(const int index) {
-    notify([&](ILibraryEvent* observer) {
-        observer->onSelected(index);
-    });
+    observers_.notify<&ILibraryEvent::onSelected>(index);
 }
 
 void LibraryEventNotifier::onEnabled(const bool state) {
-    notify([&](ILibraryEvent* observer) {
-        observer->onEnabled(state);
-    });
+    observers_.notify<&ILibraryEvent::onEnabled>(state);
 }
 
 void LibraryEventNotifier::onReveal(const bool visible) {
-    notify([&](ILibraryEvent* observer) {
-        observer->onReveal(visible);
-    });
+    observers_.notify<&ILibraryEvent::onReveal>(visible);
 }
 
 void LibraryEventNotifier::onSchedule(int) {}
 void LibraryEventNotifier::onCancel() {}
 void LibraryEventNotifier::onRepeatChanged(int) {}
 void LibraryEventNotifier::onFeedback(const std::string&, bool) {}
+
+void LibraryEventNotifier::onProgress(const std::string& name, const int percent) {
+    observers_.notify<&ILibraryEvent::onProgress>(name, percent);
+}
+
 void LibraryEventNotifier::onStopped() {}
\ No newline at end of file
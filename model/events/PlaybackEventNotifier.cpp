@@ -1,63 +1,44 @@
 #include "model/events/PlaybackEventNotifier.h"
 
 void PlaybackEventNotifier::subscribe(IPlaybackEvent& observer) {
-    observers_.push_back(&observer);
-}
-
-void PlaybackEventNotifier::notify(const std::function<void(IPlaybackEvent*)>& action) const {
-    for (auto* observer : observers_) {
-        action(observer);
-    }
+    observers_.add(observer);
 }
 
 void PlaybackEventNotifier::onStart(const std::string& path) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onStart(path);
-    });
+    observers_.notify<&IPlaybackEvent::onStart>(path);
 }
 
 void PlaybackEventNotifier::onChanged() {}
+void PlaybackEventNotifier::onDelta(const PlaylistDelta&) {}
 
 void PlaybackEventNotifier::onSelected(const int index) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onSelected(index);
-    });
+    observers_.notify<&IPlaybackEvent::onSelected>(index);
 }
 
 void PlaybackEventNotifier::onEnabled(const bool state) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onEnabled(state);
-    });
+    observers_.notify<&IPlaybackEvent::onEnabled>(state);
 }
 
 void PlaybackEventNotifier::onReveal(bool) {}
 
 void PlaybackEventNotifier::onSchedule(const int delay) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onSchedule(delay);
-    });
+    observers_.notify<&IPlaybackEvent::onSchedule>(delay);
 }
 
 void PlaybackEventNotifier::onCancel() {
-    notify([](IPlaybackEvent* observer) {
-        observer->onCancel();
-    });
+    observers_.notify<&IPlaybackEvent::onCancel>();
 }
 
 void PlaybackEventNotifier::onRepeatChanged(const int mode) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onRepeatChanged(mode);
-    });
+    observers_.notify<&IPlaybackEvent::onRepeatChanged>(mode);
 }
 
 void PlaybackEventNotifier::onFeedback(const std::string& message, const bool success) {
-    notify([&](IPlaybackEvent* observer) {
-        observer->onFeedback(message, success);
-    });
+    observers_.notify<&IPlaybackEvent::onFeedback>(message, success);
 }
 
+void PlaybackEventNotifier::onProgress(const std::string&, int) {}
+
 void PlaybackEventNotifier::onStopped() {
-    notify([](IPlaybackEvent* observer) {
-        observer->onStopped();
-    });
+    observers_.notify<&IPlaybackEvent::onStopped>();
 }
\ No newline at end of file
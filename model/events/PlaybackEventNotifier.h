@@ -3,20 +3,18 @@
 
 #include "model/events/IPlaybackListener.h"
 #include "model/events/IPlaybackEvent.h"
-#include <vector>
-#include <functional>
+#include "model/events/Broadcaster.h"
 
 class PlaybackEventNotifier final : public IPlaybackListener {
 private:
-    std::vector<IPlaybackEvent*> observers_;
-
-    void notify(const std::function<void(IPlaybackEvent*)>& action) const;
+    Broadcaster<IPlaybackEvent> observers_;
 
 public:
     void subscribe(IPlaybackEvent& observer);
 
     void onStart(const std::string& path) override;
     void onChanged() override;
+    void onDelta(const PlaylistDelta& delta) override;
     void onSelected(int index) override;
     void onEnabled(bool state) override;
     void onReveal(bool visible) override;
@@ -24,6 +22,7 @@ public:
     void onCancel() override;
     void onRepeatChanged(int mode) override;
     void onFeedback(const std::string& message, bool success) override;
+    void onProgress(const std::string& name, int percent) override;
     void onStopped() override;
 };
 
@@ -1,71 +1,66 @@
 #include "model/events/PlaybackNotifier.h"
+#include <utility>
 
 void PlaybackNotifier::add(IPlaybackListener& listener) {
-    listeners_.push_back(&listener);
+    listeners_.add(listener);
 }
 
-void PlaybackNotifier::notify(const std::function<void(IPlaybackListener*)>& action) const {
-    for (auto* listener : listeners_) {
-        action(listener);
+void PlaybackNotifier::hold() {
+    holds_++;
+}
+
+void PlaybackNotifier::release() {
+    if (holds_ == 0 || --holds_ > 0) return;
+    for (const Deferred& deferred : std::exchange(deferred_, {})) {
+        deferred.event();
     }
 }
 
 void PlaybackNotifier::onStart(const std::string& path) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onStart(path);
-    });
+    dispatch<&IPlaybackListener::onStart>(true, path);
 }
 
 void PlaybackNotifier::onChanged() {
-    notify([](IPlaybackListener* listener) {
-        listener->onChanged();
-    });
+    listeners_.notify<&IPlaybackListener::onChanged>();
+}
+
+void PlaybackNotifier::onDelta(const PlaylistDelta& delta) {
+    listeners_.notify<&IPlaybackListener::onDelta>(delta);
 }
 
 void PlaybackNotifier::onSelected(const int index) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onSelected(index);
-    });
+    std::erase_if(deferred_, [](const Deferred& deferred) { return deferred.playback; });
+    dispatch<&IPlaybackListener::onSelected>(true, index);
 }
 
 void PlaybackNotifier::onEnabled(const bool state) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onEnabled(state);
-    });
+    dispatch<&IPlaybackListener::onEnabled>(false, state);
 }
 
 void PlaybackNotifier::onReveal(const bool visible) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onReveal(visible);
-    });
+    dispatch<&IPlaybackListener::onReveal>(false, visible);
 }
 
 void PlaybackNotifier::onSchedule(const int delay) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onSchedule(delay);
-    });
+    dispatch<&IPlaybackListener::onSchedule>(false, delay);
 }
 
 void PlaybackNotifier::onCancel() {
-    notify([](IPlaybackListener* listener) {
-        listener->onCancel();
-    });
+    dispatch<&IPlaybackListener::onCancel>(false);
 }
 
 void PlaybackNotifier::onRepeatChanged(const int mode) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onRepeatChanged(mode);
-    });
+    dispatch<&IPlaybackListener::onRepeatChanged>(false, mode);
 }
 
 void PlaybackNotifier::onFeedback(const std::string& message, const bool success) {
-    notify([&](IPlaybackListener* listener) {
-        listener->onFeedback(message, success);
-    });
+    dispatch<&IPlaybackListener::onFeedback>(false, message, success);
+}
+
+void PlaybackNotifier::onProgress(const std::string& name, const int percent) {
+    dispatch<&IPlaybackListener::onProgress>(false, name, percent);
 }
 
 void PlaybackNotifier::onStopped() {
-    notify([](IPlaybackListener* listener) {
-        listener->onStopped();
-    });
+    dispatch<&IPlaybackListener::onStopped>(false);
 }
\ No newline at end of file
@@ -2,20 +2,38 @@
 #define PLAYBACK_NOTIFIER_H
 
 #include "model/events/IPlaybackListener.h"
-#include <vector>
-#include <string>
+#include "model/events/Broadcaster.h"
 #include <functional>
+#include <string>
+#include <vector>
 
 class PlaybackNotifier final : public IPlaybackListener {
 private:
-    std::vector<IPlaybackListener*> listeners_;
+    struct Deferred {
+        bool playback = false;
+        std::function<void()> event;
+    };
+
+    Broadcaster<IPlaybackListener> listeners_;
+    std::vector<Deferred> deferred_;
+    int holds_ = 0;
 
-    void notify(const std::function<void(IPlaybackListener*)>& action) const;
+    template <auto Event, typename... Args>
+    void dispatch(const bool playback, const Args&... args) {
+        if (holds_ == 0) {
+            listeners_.notify<Event>(args...);
+            return;
+        }
+        deferred_.push_back({playback, [this, ...args = args] { listeners_.notify<Event>(args...); }});
+    }
 
 public:
     void add(IPlaybackListener& listener);
+    void hold();
+    void release();
     void onStart(const std::string& path) override;
     void onChanged() override;
+    void onDelta(const PlaylistDelta& delta) override;
     void onSelected(int index) override;
     void onEnabled(bool state) override;
     void onReveal(bool visible) override;
@@ -23,7 +41,8 @@ public:
     void onCancel() override;
     void onRepeatChanged(int mode) override;
     void onFeedback(const std::string& message, bool success) override;
+    void onProgress(const std::string& name, int percent) override;
     void onStopped() override;
 };
 
-#endif //PLAYBACK_NOTIFIER_H
\ No newline at end of file
+#endif //PLAYBACK_NOTIFIER_H
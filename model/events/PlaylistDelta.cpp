@@ -0,0 +1,45 @@
+#include "model/events/PlaylistDelta.h"
+
+void PlaylistDelta::insert(const std::size_t position) {
+    if (!steps_.empty()) {
+        Step& last = steps_.back();
+        if (last.kind == Kind::Inserted && position >= last.first && position <= last.first + last.count) {
+            last.count++;
+            return;
+        }
+    }
+    steps_.push_back({Kind::Inserted, position, 1, {}});
+}
+
+void PlaylistDelta::remove(const std::size_t position, const std::size_t count) {
+    if (count == 0) return;
+    if (!steps_.empty()) {
+        Step& last = steps_.back();
+        if (last.kind == Kind::Removed && (position == last.first || position + count == last.first)) {
+            last.first = position;
+            last.count += count;
+            return;
+        }
+    }
+    steps_.push_back({Kind::Removed, position, count, {}});
+}
+
+void PlaylistDelta::move(std::vector<std::size_t> order) {
+    if (!steps_.empty() && steps_.back().kind == Kind::Moved) {
+        const std::vector<std::size_t>& previous = steps_.back().order;
+        for (std::size_t& index : order) {
+            index = previous[index];
+        }
+        steps_.back().order = std::move(order);
+        return;
+    }
+    steps_.push_back({Kind::Moved, 0, order.size(), std::move(order)});
+}
+
+bool PlaylistDelta::isEmpty() const {
+    return steps_.empty();
+}
+
+const std::vector<PlaylistDelta::Step>& PlaylistDelta::steps() const {
+    return steps_;
+}
@@ -0,0 +1,29 @@
+#ifndef PLAYLIST_DELTA_H
+#define PLAYLIST_DELTA_H
+
+#include <cstddef>
+#include <vector>
+
+class PlaylistDelta final {
+public:
+    enum class Kind { Inserted, Removed, Moved };
+
+    struct Step {
+        Kind kind;
+        std::size_t first = 0;
+        std::size_t count = 0;
+        std::vector<std::size_t> order;
+    };
+
+private:
+    std::vector<Step> steps_;
+
+public:
+    void insert(std::size_t position);
+    void remove(std::size_t position, std::size_t count = 1);
+    void move(std::vector<std::size_t> order);
+    bool isEmpty() const;
+    const std::vector<Step>& steps() const;
+};
+
+#endif //PLAYLIST_DELTA_H
@@ -0,0 +1,154 @@
+#include "model/library/ContentHash.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+    constexpr std::size_t kBlock = 4 * 1024 * 1024;
+
+    std::uint64_t read64(const char* data) {
+        std::uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    std::uint32_t read32(const char* data) {
+        std::uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    std::uint64_t round(std::uint64_t accumulator, const std::uint64_t input) {
+        accumulator += input * kPrime2;
+        return std::rotl(accumulator, 31) * kPrime1;
+    }
+
+    std::uint64_t merge(const std::uint64_t accumulator, const std::uint64_t lane) {
+        return (accumulator ^ round(0, lane)) * kPrime1 + kPrime4;
+    }
+
+    std::size_t blocks(const std::size_t size) {
+        return std::max<std::size_t>((size + kBlock - 1) / kBlock, 1);
+    }
+
+    std::string_view block(const std::string_view content, const std::size_t index) {
+        return content.substr(index * kBlock, kBlock);
+    }
+}
+
+std::uint64_t ContentHash::hash(const std::string_view data, const std::uint64_t seed) {
+    const char* cursor = data.data();
+    const char* const end = cursor + data.size();
+    std::uint64_t result;
+
+    if (data.size() >= 32) {
+        std::uint64_t lanes[4] = {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+        for (; cursor + 32 <= end; cursor += 32) {
+            for (int lane = 0; lane < 4; lane++) {
+                lanes[lane] = round(lanes[lane], read64(cursor + lane * 8));
+            }
+        }
+        result = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+        for (const std::uint64_t lane : lanes) {
+            result = merge(result, lane);
+        }
+    } else {
+        result = seed + kPrime5;
+    }
+    result += data.size();
+
+    for (; cursor + 8 <= end; cursor += 8) {
+        result ^= round(0, read64(cursor));
+        result = std::rotl(result, 27) * kPrime1 + kPrime4;
+    }
+    if (cursor + 4 <= end) {
+        result ^= read32(cursor) * kPrime1;
+        result = std::rotl(result, 23) * kPrime2 + kPrime3;
+        cursor += 4;
+    }
+    for (; cursor < end; cursor++) {
+        result ^= static_cast<unsigned char>(*cursor) * kPrime5;
+        result = std::rotl(result, 11) * kPrime1;
+    }
+
+    result ^= result >> 33;
+    result *= kPrime2;
+    result ^= result >> 29;
+    result *= kPrime3;
+    result ^= result >> 32;
+    return result;
+}
+
+std::uint64_t ContentHash::combine(const std::uint64_t* blocks, const std::size_t count, const std::size_t size) {
+    return hash(std::string_view(reinterpret_cast<const char*>(blocks), count * sizeof(std::uint64_t)), size);
+}
+
+std::uint64_t ContentHash::digest(const std::string_view content) {
+    std::vector<std::uint64_t> digests(blocks(content.size()));
+    for (std::size_t i = 0; i < digests.size(); i++) {
+        digests[i] = hash(block(content, i));
+    }
+    return combine(digests.data(), digests.size(), content.size());
+}
+
+bool ContentHash::digest(const std::string& path, std::uint64_t& result) {
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) return false;
+
+    struct stat status {};
+    if (::fstat(file, &status) != 0 || !S_ISREG(status.st_mode)) {
+        ::close(file);
+        return false;
+    }
+    const std::size_t size = status.st_size;
+    if (size == 0) {
+        ::close(file);
+        result = digest(std::string_view());
+        return true;
+    }
+
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping == MAP_FAILED) return false;
+    ::madvise(mapping, size, MADV_SEQUENTIAL);
+
+    const std::string_view content(static_cast<const char*>(mapping), size);
+    std::vector<std::uint64_t> digests(blocks(size));
+    const std::size_t workers = std::min<std::size_t>(digests.size(), std::max(1u, std::thread::hardware_concurrency()));
+    const auto work = [&](const std::size_t first) {
+        for (std::size_t i = first; i < digests.size(); i += workers) {
+            digests[i] = hash(block(content, i));
+        }
+    };
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t worker = 1; worker < workers; worker++) {
+            threads.emplace_back(work, worker);
+        }
+        work(0);
+    }
+    ::munmap(mapping, size);
+
+    result = combine(digests.data(), digests.size(), size);
+    return true;
+}
+
+std::string ContentHash::format(const std::uint64_t digest) {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    std::string text(16, '0');
+    for (int i = 15; i >= 0; i--) {
+        text[i] = kDigits[(digest >> ((15 - i) * 4)) & 0xF];
+    }
+    return text;
+}
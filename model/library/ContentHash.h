@@ -0,0 +1,20 @@
+#ifndef CONTENT_HASH_H
+#define CONTENT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class ContentHash {
+public:
+    static bool digest(const std::string& path, std::uint64_t& result);
+    static std::uint64_t digest(std::string_view content);
+    static std::uint64_t hash(std::string_view data, std::uint64_t seed = 0);
+    static std::string format(std::uint64_t digest);
+
+private:
+    static std::uint64_t combine(const std::uint64_t* blocks, std::size_t count, std::size_t size);
+};
+
+#endif //CONTENT_HASH_H
@@ -0,0 +1,133 @@
+#include "model/library/DirectoryWatcher.h"
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+namespace {
+    constexpr std::uint32_t kEvents = IN_CREATE | IN_CLOSE_WRITE | IN_ATTRIB |
+                                      IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+    constexpr int kQuiet = 50;
+    constexpr auto kLimit = std::chrono::milliseconds(500);
+
+    bool isWithin(const std::string& path, const std::string& directory) {
+        return path.starts_with(directory) && (path.size() == directory.size() || path[directory.size()] == '/');
+    }
+}
+
+DirectoryWatcher::~DirectoryWatcher() {
+    stop();
+}
+
+bool DirectoryWatcher::watch(const std::string& directory,
+                             const std::function<void(const std::vector<std::string>&)>& callback) {
+    stop();
+    descriptor_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wake_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (descriptor_ >= 0 && wake_ >= 0) follow(directory);
+    if (folders_.empty()) {
+        release();
+        return false;
+    }
+    directory_ = directory;
+    callback_ = callback;
+    thread_ = std::thread(&DirectoryWatcher::run, this);
+    return true;
+}
+
+void DirectoryWatcher::stop() {
+    if (thread_.joinable()) {
+        const std::uint64_t signal = 1;
+        [[maybe_unused]] const ssize_t written = ::write(wake_, &signal, sizeof(signal));
+        thread_.join();
+    }
+    release();
+}
+
+bool DirectoryWatcher::isWatching() const {
+    return thread_.joinable();
+}
+
+void DirectoryWatcher::run() {
+    pollfd sources[] = {{descriptor_, POLLIN, 0}, {wake_, POLLIN, 0}};
+    std::set<std::string> changed;
+    auto burst = std::chrono::steady_clock::now();
+    while (true) {
+        const int ready = ::poll(sources, 2, changed.empty() ? -1 : kQuiet);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        if (sources[1].revents & POLLIN) return;
+        if (sources[0].revents & POLLIN) {
+            if (changed.empty()) burst = std::chrono::steady_clock::now();
+            drain(changed);
+        }
+        if (!changed.empty() && (ready == 0 || std::chrono::steady_clock::now() - burst >= kLimit)) {
+            callback_(std::vector<std::string>(changed.begin(), changed.end()));
+            changed.clear();
+        }
+    }
+}
+
+void DirectoryWatcher::drain(std::set<std::string>& changed) {
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = ::read(descriptor_, buffer, sizeof(buffer))) > 0) {
+        for (const char* cursor = buffer; cursor < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(cursor);
+            cursor += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                changed.insert(directory_);
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                folders_.erase(event->wd);
+                continue;
+            }
+            const auto folder = folders_.find(event->wd);
+            if (event->len == 0 || folder == folders_.end()) continue;
+
+            const std::string path = folder->second + "/" + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) follow(path);
+                if (event->mask & (IN_DELETE | IN_MOVED_FROM)) unfollow(path);
+            }
+            changed.insert(path);
+        }
+    }
+}
+
+void DirectoryWatcher::follow(const std::string& directory) {
+    const int watch = inotify_add_watch(descriptor_, directory.c_str(), kEvents | IN_ONLYDIR);
+    if (watch < 0) return;
+    folders_.insert_or_assign(watch, directory);
+
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_directory(error) && !entry.is_symlink(error)) {
+            follow(entry.path().string());
+        }
+    }
+}
+
+void DirectoryWatcher::unfollow(const std::string& directory) {
+    std::erase_if(folders_, [&](const auto& folder) {
+        if (!isWithin(folder.second, directory)) return false;
+        inotify_rm_watch(descriptor_, folder.first);
+        return true;
+    });
+}
+
+void DirectoryWatcher::release() {
+    if (descriptor_ >= 0) ::close(descriptor_);
+    if (wake_ >= 0) ::close(wake_);
+    descriptor_ = -1;
+    wake_ = -1;
+    folders_.clear();
+}
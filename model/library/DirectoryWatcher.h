@@ -0,0 +1,37 @@
+#ifndef DIRECTORY_WATCHER_H
+#define DIRECTORY_WATCHER_H
+
+#include <set>
+#include <string>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <unordered_map>
+
+class DirectoryWatcher {
+private:
+    std::string directory_;
+    std::function<void(const std::vector<std::string>&)> callback_;
+    std::unordered_map<int, std::string> folders_;
+    std::thread thread_;
+    int descriptor_ = -1;
+    int wake_ = -1;
+
+    void run();
+    void drain(std::set<std::string>& changed);
+    void follow(const std::string& directory);
+    void unfollow(const std::string& directory);
+    void release();
+
+public:
+    DirectoryWatcher() = default;
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+    ~DirectoryWatcher();
+
+    bool watch(const std::string& directory, const std::function<void(const std::vector<std::string>&)>& callback);
+    void stop();
+    bool isWatching() const;
+};
+
+#endif //DIRECTORY_WATCHER_H
@@ -0,0 +1,112 @@
+#include "model/library/FileTransfer.h"
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+namespace {
+    constexpr long long kChunk = 8 * 1024 * 1024;
+    constexpr std::size_t kBuffer = 1024 * 1024;
+}
+
+bool FileTransfer::copy(const std::string& source, const std::string& destination, const Progress& progress) {
+    return duplicate(source, destination, progress, true);
+}
+
+bool FileTransfer::duplicate(const std::string& source, const std::string& destination, const Progress& progress,
+                             const bool linkable) {
+    const int from = ::open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (from < 0) return false;
+
+    struct stat origin {};
+    struct stat folder {};
+    const std::string parent = std::filesystem::path(destination).parent_path().string();
+    if (::fstat(from, &origin) != 0 || ::stat(parent.empty() ? "." : parent.c_str(), &folder) != 0) {
+        ::close(from);
+        return false;
+    }
+    const bool shared = origin.st_dev == folder.st_dev;
+
+    const std::string part = destination + ".part";
+    const int to = ::open(part.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (to < 0) {
+        ::close(from);
+        return false;
+    }
+
+    bool copied = shared && ::ioctl(to, FICLONE, from) == 0;
+    bool linked = false;
+    if (!copied && shared && linkable) {
+        linked = ::link(source.c_str(), destination.c_str()) == 0;
+    }
+    if (!copied && !linked) {
+        copied = stream(from, to, origin.st_size, progress);
+    }
+    ::close(from);
+    ::close(to);
+
+    if (copied && ::renameat2(AT_FDCWD, part.c_str(), AT_FDCWD, destination.c_str(), RENAME_NOREPLACE) != 0) {
+        copied = false;
+    }
+    if (!copied) ::unlink(part.c_str());
+    if (copied || linked) progress(100);
+    return copied || linked;
+}
+
+bool FileTransfer::store(const std::string& source, const std::string& object, const std::string& destination,
+                         const Progress& progress) {
+    struct stat status {};
+    const bool stored = ::stat(object.c_str(), &status) == 0;
+    if (!stored) {
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(object).parent_path(), error);
+        if (!duplicate(source, object, progress, false) && ::stat(object.c_str(), &status) != 0) return false;
+    }
+    if (::link(object.c_str(), destination.c_str()) != 0) return false;
+    if (stored) progress(100);
+    return true;
+}
+
+bool FileTransfer::stream(const int from, const int to, const long long size, const Progress& progress) {
+    long long done = 0;
+    while (done < size) {
+        const ssize_t moved = ::copy_file_range(from, nullptr, to, nullptr, std::min(kChunk, size - done), 0);
+        if (moved < 0 && errno == EINTR) continue;
+        if (moved < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+            return relay(from, to, done, size, progress);
+        }
+        if (moved <= 0) return false;
+        done += moved;
+        if (!progress(percent(done, size))) return false;
+    }
+    return true;
+}
+
+bool FileTransfer::relay(const int from, const int to, long long offset, const long long size,
+                         const Progress& progress) {
+    std::vector<char> buffer(kBuffer);
+    while (offset < size) {
+        const ssize_t length = ::pread(from, buffer.data(), buffer.size(), offset);
+        if (length < 0 && errno == EINTR) continue;
+        if (length <= 0) return false;
+        for (ssize_t written = 0; written < length;) {
+            const ssize_t step = ::pwrite(to, buffer.data() + written, length - written, offset + written);
+            if (step < 0 && errno == EINTR) continue;
+            if (step <= 0) return false;
+            written += step;
+        }
+        offset += length;
+        if (!progress(percent(offset, size))) return false;
+    }
+    return true;
+}
+
+int FileTransfer::percent(const long long done, const long long size) {
+    return size > 0 ? static_cast<int>(done * 100 / size) : 100;
+}
@@ -0,0 +1,23 @@
+#ifndef FILE_TRANSFER_H
+#define FILE_TRANSFER_H
+
+#include <functional>
+#include <string>
+
+class FileTransfer {
+public:
+    using Progress = std::function<bool(int percent)>;
+
+    static bool copy(const std::string& source, const std::string& destination, const Progress& progress);
+    static bool store(const std::string& source, const std::string& object, const std::string& destination,
+                      const Progress& progress);
+
+private:
+    static bool duplicate(const std::string& source, const std::string& destination, const Progress& progress,
+                          bool linkable);
+    static bool stream(int from, int to, long long size, const Progress& progress);
+    static bool relay(int from, int to, long long offset, long long size, const Progress& progress);
+    static int percent(long long done, long long size);
+};
+
+#endif //FILE_TRANSFER_H
@@ -0,0 +1,112 @@
+#include "model/library/ImportQueue.h"
+#include "model/library/FileTransfer.h"
+#include "model/library/ContentHash.h"
+#include <filesystem>
+
+ImportQueue::ImportQueue(const std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+ImportQueue::~ImportQueue() {
+    stop();
+}
+
+void ImportQueue::submit(const std::vector<std::string>& sources, const Plan& plan, const Progress& progress,
+                         const Completion& completion) {
+    if (sources.empty()) return;
+
+    const auto batch = std::make_shared<Batch>();
+    batch->remaining = sources.size();
+    batch->plan = plan;
+    batch->progress = progress;
+    batch->completion = completion;
+    {
+        std::lock_guard lock(mutex_);
+        if (stopping_) return;
+        for (const auto& source : sources) {
+            jobs_.push_back({{source, "", ""}, batch});
+        }
+        while (workers_.size() < std::min(capacity_, jobs_.size())) {
+            workers_.emplace_back(&ImportQueue::run, this);
+        }
+    }
+    ready_.notify_all();
+}
+
+bool ImportQueue::isPending(const std::string& path) const {
+    std::lock_guard lock(mutex_);
+    return pending_.contains(path);
+}
+
+void ImportQueue::stop() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+        jobs_.clear();
+    }
+    ready_.notify_all();
+    workers_.clear();
+}
+
+void ImportQueue::run() {
+    while (true) {
+        std::unique_lock lock(mutex_);
+        ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (stopping_) return;
+
+        const Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+        process(job);
+    }
+}
+
+void ImportQueue::process(const Job& job) {
+    Transfer transfer = job.transfer;
+    Batch& batch = *job.batch;
+    std::uint64_t digest = 0;
+    std::string reason;
+    const bool hashed = ContentHash::digest(transfer.source, digest);
+    if (hashed) reason = claim(transfer, digest, batch);
+    bool success = false;
+    if (hashed && reason.empty()) {
+        const std::string name = std::filesystem::path(transfer.destination).filename().string();
+        int reported = -1;
+        success = FileTransfer::store(transfer.source, transfer.object, transfer.destination, [&](const int percent) {
+            if (percent != reported) {
+                reported = percent;
+                batch.progress(name, percent);
+            }
+            return !stopping_;
+        });
+    }
+
+    {
+        std::lock_guard lock(batch.mutex);
+        if (success) {
+            batch.committed.push_back(transfer.destination);
+        } else if (!reason.empty()) {
+            batch.rejected.push_back(reason);
+        } else {
+            batch.failed++;
+        }
+        if (--batch.remaining > 0) return;
+    }
+    batch.completion(batch.committed, batch.rejected, batch.failed);
+
+    std::lock_guard lock(mutex_);
+    for (const auto& path : batch.paths) {
+        pending_.erase(path);
+    }
+}
+
+std::string ImportQueue::claim(Transfer& transfer, const std::uint64_t digest, Batch& batch) {
+    std::lock_guard planning(planning_);
+    std::string reason = batch.plan(transfer, digest);
+    if (!reason.empty()) return reason;
+
+    std::lock_guard lock(mutex_);
+    pending_.insert(transfer.object);
+    pending_.insert(transfer.destination);
+    batch.paths.push_back(transfer.object);
+    batch.paths.push_back(transfer.destination);
+    return "";
+}
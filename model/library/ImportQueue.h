@@ -0,0 +1,73 @@
+#ifndef IMPORT_QUEUE_H
+#define IMPORT_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class ImportQueue {
+public:
+    using Progress = std::function<void(const std::string& name, int percent)>;
+    using Completion = std::function<void(const std::vector<std::string>& committed,
+                                          const std::vector<std::string>& rejected, int failed)>;
+
+    struct Transfer {
+        std::string source;
+        std::string object;
+        std::string destination;
+    };
+
+    using Plan = std::function<std::string(Transfer& transfer, std::uint64_t digest)>;
+
+private:
+    struct Batch {
+        std::mutex mutex;
+        std::size_t remaining = 0;
+        std::vector<std::string> paths;
+        std::vector<std::string> committed;
+        std::vector<std::string> rejected;
+        int failed = 0;
+        Plan plan;
+        Progress progress;
+        Completion completion;
+    };
+
+    struct Job {
+        Transfer transfer;
+        std::shared_ptr<Batch> batch;
+    };
+
+    std::size_t capacity_;
+    mutable std::mutex mutex_;
+    std::mutex planning_;
+    std::condition_variable ready_;
+    std::deque<Job> jobs_;
+    std::unordered_set<std::string> pending_;
+    std::atomic<bool> stopping_ = false;
+    std::vector<std::jthread> workers_;
+
+    void run();
+    void process(const Job& job);
+    std::string claim(Transfer& transfer, std::uint64_t digest, Batch& batch);
+
+public:
+    explicit ImportQueue(std::size_t capacity = 4);
+    ImportQueue(const ImportQueue&) = delete;
+    ImportQueue& operator=(const ImportQueue&) = delete;
+    ~ImportQueue();
+
+    void submit(const std::vector<std::string>& sources, const Plan& plan, const Progress& progress,
+                const Completion& completion);
+    bool isPending(const std::string& path) const;
+    void stop();
+};
+
+#endif //IMPORT_QUEUE_H
@@ -0,0 +1,57 @@
+#include "model/library/LibraryChange.h"
+#include "model/library/MusicLibrary.h"
+
+void LibraryChange::add(const std::string& path) {
+    added_.push_back(path);
+}
+
+void LibraryChange::remove(const std::string& path) {
+    removed_.push_back(path);
+}
+
+void LibraryChange::revise(const std::string& path) {
+    revised_.push_back(path);
+}
+
+void LibraryChange::complete() {
+    complete_ = true;
+}
+
+bool LibraryChange::isEmpty() const {
+    return added_.empty() && removed_.empty() && revised_.empty() && !complete_;
+}
+
+bool LibraryChange::apply(Playlist& playlist) const {
+    const std::vector<Song> songs = MusicLibrary::describe(added_);
+    std::size_t changed = 0;
+
+    if (complete_) {
+        std::unordered_set<std::uint64_t> present;
+        for (const Song& song : songs) {
+            present.insert(song.id());
+        }
+        changed += playlist.prune([&](const Song& song) { return !present.contains(song.id()); });
+    } else if (!removed_.empty()) {
+        std::unordered_set<std::string> gone;
+        gone.reserve(removed_.size());
+        for (std::string path : removed_) {
+            while (path.size() > 1 && path.back() == '/') path.pop_back();
+            gone.insert(std::move(path));
+        }
+        changed += playlist.prune([&](const Song& song) { return isGone(song, gone); });
+    }
+    if (!revised_.empty()) playlist.revise(MusicLibrary::describe(revised_));
+    changed += playlist.merge(songs);
+    return changed > 0;
+}
+
+bool LibraryChange::isGone(const Song& song, const std::unordered_set<std::string>& gone) {
+    std::string path = song.path();
+    while (!path.empty()) {
+        if (gone.contains(path)) return true;
+        const std::size_t slash = path.rfind('/');
+        if (slash == std::string::npos || slash == 0) return false;
+        path.resize(slash);
+    }
+    return false;
+}
@@ -0,0 +1,27 @@
+#ifndef LIBRARY_CHANGE_H
+#define LIBRARY_CHANGE_H
+
+#include "model/core/Playlist.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class LibraryChange final {
+private:
+    std::vector<std::string> added_;
+    std::vector<std::string> removed_;
+    std::vector<std::string> revised_;
+    bool complete_ = false;
+
+    static bool isGone(const Song& song, const std::unordered_set<std::string>& gone);
+
+public:
+    void add(const std::string& path);
+    void remove(const std::string& path);
+    void revise(const std::string& path);
+    void complete();
+    bool isEmpty() const;
+    bool apply(Playlist& playlist) const;
+};
+
+#endif //LIBRARY_CHANGE_H
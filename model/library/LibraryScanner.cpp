@@ -0,0 +1,178 @@
+#include "model/library/LibraryScanner.h"
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    struct LinuxDirent {
+        std::uint64_t inode;
+        std::int64_t offset;
+        unsigned short length;
+        unsigned char type;
+        char name[];
+    };
+
+    constexpr std::size_t kBuffer = 32 * 1024;
+}
+
+LibraryScanner::LibraryScanner(const std::string& root, const std::function<bool(const std::string&)>& filter,
+                               const std::size_t batch)
+    : filter_(filter), batch_(std::max<std::size_t>(batch, 1)) {
+    const std::size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t i = 0; i < workers; i++) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    push(0, root);
+
+    running_ = workers;
+    for (std::size_t i = 0; i < workers; i++) {
+        threads_.emplace_back(&LibraryScanner::run, this, i);
+    }
+}
+
+bool LibraryScanner::next(std::vector<std::string>& batch) {
+    std::unique_lock lock(mutex_);
+    ready_.wait(lock, [this] { return !batches_.empty() || running_ == 0; });
+    if (batches_.empty()) return false;
+
+    batch = std::move(batches_.front());
+    batches_.pop_front();
+    return true;
+}
+
+long long LibraryScanner::newest() const {
+    return newest_.load();
+}
+
+void LibraryScanner::run(const std::size_t self) {
+    std::vector<std::string> found;
+    std::string directory;
+    while (true) {
+        std::size_t seen;
+        {
+            std::lock_guard lock(idle_mutex_);
+            seen = posted_;
+        }
+        if (take(self, directory)) {
+            walk(self, directory, found);
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard lock(idle_mutex_);
+                idle_.notify_all();
+            }
+            continue;
+        }
+        if (!found.empty()) publish(found);
+
+        std::unique_lock lock(idle_mutex_);
+        idle_.wait(lock, [this, seen] { return posted_ != seen || pending_.load() == 0; });
+        if (pending_.load() == 0) break;
+    }
+    finish();
+}
+
+bool LibraryScanner::take(const std::size_t self, std::string& directory) {
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard lock(own.mutex);
+        if (!own.directories.empty()) {
+            directory = std::move(own.directories.back());
+            own.directories.pop_back();
+            return true;
+        }
+    }
+    for (std::size_t step = 1; step < queues_.size(); step++) {
+        Queue& victim = *queues_[(self + step) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.directories.empty()) {
+            directory = std::move(victim.directories.front());
+            victim.directories.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void LibraryScanner::push(const std::size_t self, std::string directory) {
+    pending_.fetch_add(1);
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard lock(own.mutex);
+        own.directories.push_back(std::move(directory));
+    }
+    std::lock_guard lock(idle_mutex_);
+    posted_++;
+    idle_.notify_one();
+}
+
+void LibraryScanner::walk(const std::size_t self, const std::string& directory, std::vector<std::string>& found) {
+    const int descriptor = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (descriptor < 0) return;
+
+    struct stat status {};
+    if (::fstat(descriptor, &status) == 0) {
+        const long long stamp = status.st_mtim.tv_sec * 1'000'000'000LL + status.st_mtim.tv_nsec;
+        long long newest = newest_.load();
+        while (stamp > newest && !newest_.compare_exchange_weak(newest, stamp)) {}
+    }
+
+    alignas(LinuxDirent) char buffer[kBuffer];
+    long filled;
+    while ((filled = ::syscall(SYS_getdents64, descriptor, buffer, kBuffer)) > 0) {
+        for (long offset = 0; offset < filled;) {
+            const auto* entry = reinterpret_cast<const LinuxDirent*>(buffer + offset);
+            offset += entry->length;
+            if (std::strcmp(entry->name, ".") == 0 || std::strcmp(entry->name, "..") == 0) continue;
+
+            unsigned char type = entry->type;
+            if (type == DT_UNKNOWN || type == DT_LNK) {
+                struct stat target {};
+                const int flags = type == DT_UNKNOWN ? AT_SYMLINK_NOFOLLOW : 0;
+                if (::fstatat(descriptor, entry->name, &target, flags) != 0) continue;
+                if (S_ISREG(target.st_mode)) {
+                    type = DT_REG;
+                } else if (S_ISDIR(target.st_mode) && type == DT_UNKNOWN) {
+                    type = DT_DIR;
+                }
+            }
+
+            if (type == DT_DIR) {
+                push(self, join(directory, entry->name));
+            } else if (type == DT_REG) {
+                std::string path = join(directory, entry->name);
+                if (filter_(path)) found.push_back(std::move(path));
+                if (found.size() >= batch_) publish(found);
+            }
+        }
+    }
+    ::close(descriptor);
+}
+
+void LibraryScanner::publish(std::vector<std::string>& found) {
+    {
+        std::lock_guard lock(mutex_);
+        batches_.push_back(std::move(found));
+    }
+    found.clear();
+    ready_.notify_one();
+}
+
+void LibraryScanner::finish() {
+    {
+        std::lock_guard lock(mutex_);
+        running_--;
+    }
+    ready_.notify_all();
+}
+
+std::string LibraryScanner::join(const std::string& directory, const char* name) {
+    std::string path;
+    path.reserve(directory.size() + std::strlen(name) + 1);
+    path.append(directory);
+    if (path.empty() || path.back() != '/') path.push_back('/');
+    return path.append(name);
+}
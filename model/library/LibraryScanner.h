@@ -0,0 +1,53 @@
+#ifndef LIBRARY_SCANNER_H
+#define LIBRARY_SCANNER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class LibraryScanner {
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::string> directories;
+    };
+
+    std::function<bool(const std::string&)> filter_;
+    std::size_t batch_;
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<std::size_t> pending_ = 0;
+    std::atomic<long long> newest_ = 0;
+    std::mutex idle_mutex_;
+    std::condition_variable idle_;
+    std::size_t posted_ = 0;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::vector<std::string>> batches_;
+    std::size_t running_ = 0;
+    std::vector<std::jthread> threads_;
+
+    void run(std::size_t self);
+    bool take(std::size_t self, std::string& directory);
+    void push(std::size_t self, std::string directory);
+    void walk(std::size_t self, const std::string& directory, std::vector<std::string>& found);
+    void publish(std::vector<std::string>& found);
+    void finish();
+    static std::string join(const std::string& directory, const char* name);
+
+public:
+    LibraryScanner(const std::string& root, const std::function<bool(const std::string&)>& filter,
+                   std::size_t batch = 256);
+    LibraryScanner(const LibraryScanner&) = delete;
+    LibraryScanner& operator=(const LibraryScanner&) = delete;
+
+    bool next(std::vector<std::string>& batch);
+    long long newest() const;
+};
+
+#endif //LIBRARY_SCANNER_H
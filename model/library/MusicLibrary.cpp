@@ -1,60 +1,274 @@
 #include "model/library/MusicLibrary.h"
 #include "model/core/Song.h"
+#include "model/core/MetadataCache.h"
+#include "model/library/LibraryScanner.h"
+#include "model/library/FileTransfer.h"
+#include "model/library/ContentHash.h"
+#include <sys/stat.h>
+#include <dirent.h>
+#include <algorithm>
+#include <unordered_set>
 #include <filesystem>
 
 MusicLibrary::MusicLibrary(const std::string& musicPath)
     : music_path_(musicPath) {
 }
 
-std::vector<std::string> MusicLibrary::scan(const std::string& directory) {
-    std::vector<std::string> result;
-    if (!std::filesystem::exists(directory)) return result;
+MusicLibrary::~MusicLibrary() {
+    imports_.stop();
+    if (watcher_.isWatching()) {
+        watcher_.stop();
+        MetadataCache::shared().save(catalog(), music_path_);
+    }
+}
 
-    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-        if (entry.is_regular_file() && isSupported(entry.path().string())) {
-            result.push_back(entry.path().string());
+std::string MusicLibrary::catalog() const {
+    return music_path_ + "/.metadata";
+}
+
+std::string MusicLibrary::object(const std::uint64_t digest) const {
+    return objects() + "/" + ContentHash::format(digest);
+}
+
+std::string MusicLibrary::objects() const {
+    return music_path_ + "/.objects";
+}
+
+std::string MusicLibrary::stored(const std::string& path) const {
+    struct stat status {};
+    if (::stat(path.c_str(), &status) != 0 || status.st_nlink < 2) return "";
+    DIR* directory = ::opendir(objects().c_str());
+    if (!directory) return "";
+    std::string found;
+    while (const dirent* item = ::readdir(directory)) {
+        if (item->d_ino != status.st_ino) continue;
+        const std::string candidate = objects() + "/" + item->d_name;
+        std::error_code error;
+        if (std::filesystem::equivalent(path, candidate, error)) {
+            found = candidate;
+            break;
         }
     }
+    ::closedir(directory);
+    return found;
+}
+
+bool MusicLibrary::isStored(const std::string& object) const {
+    std::error_code error;
+    const auto links = std::filesystem::hard_link_count(object, error);
+    return !error && links > 1;
+}
+
+std::vector<std::string> MusicLibrary::scan(const std::string& directory) {
+    std::vector<std::string> result;
+    LibraryScanner scanner(directory, isSupported);
+    std::vector<std::string> batch;
+    while (scanner.next(batch)) {
+        std::ranges::move(batch, std::back_inserter(result));
+    }
     return result;
 }
 
 std::vector<Song> MusicLibrary::load() const {
     std::vector<Song> songs;
-    for (const auto& path : scan(music_path_)) {
-        const std::string filename = std::filesystem::path(path).filename().string();
-        songs.emplace_back(filename, path);
-    }
+    stream([&](const std::vector<Song>& batch) {
+        songs.insert(songs.end(), batch.begin(), batch.end());
+    });
     return songs;
 }
 
+void MusicLibrary::stream(const std::function<void(const std::vector<Song>&)>& consumer) const {
+    LibraryScanner scanner(music_path_, isSupported);
+    std::vector<std::string> paths;
+    std::vector<std::string> batch;
+    while (scanner.next(batch)) {
+        consumer(describe(batch));
+        std::ranges::move(batch, std::back_inserter(paths));
+    }
+
+    MetadataCache& cache = MetadataCache::shared();
+    cache.restore(catalog(), music_path_, scanner.newest());
+    cache.fill(paths);
+    cache.save(catalog(), music_path_);
+    names_.reset(entries(paths));
+}
+
+void MusicLibrary::watch(const std::function<void(const LibraryChange&)>& consumer) {
+    prune();
+    watcher_.watch(music_path_, [this, consumer](const std::vector<std::string>& paths) {
+        const LibraryChange change = survey(paths);
+        if (!change.isEmpty()) consumer(change);
+    });
+}
+
+LibraryChange MusicLibrary::survey(const std::vector<std::string>& paths) const {
+    LibraryChange change;
+    MetadataCache& cache = MetadataCache::shared();
+    std::vector<std::string> found;
+    for (const auto& path : paths) {
+        std::error_code error;
+        const auto status = std::filesystem::status(path, error);
+        if (path == music_path_) {
+            change.complete();
+            std::vector<std::string> scanned = scan(path);
+            names_.reset(entries(scanned));
+            std::ranges::move(scanned, std::back_inserter(found));
+        } else if (std::filesystem::is_directory(status)) {
+            std::ranges::move(scan(path), std::back_inserter(found));
+        } else if (std::filesystem::is_regular_file(status)) {
+            if (!isSupported(path) || imports_.isPending(path)) continue;
+            if (cache.refresh(path)) change.revise(path);
+            names_.insert(entry(path));
+            change.add(path);
+        } else if (!std::filesystem::exists(status)) {
+            cache.forget(path);
+            names_.erase(entry(path));
+            change.remove(path);
+        }
+    }
+    cache.fill(found);
+    for (const auto& path : found) {
+        names_.insert(entry(path));
+        change.add(path);
+    }
+    return change;
+}
+
 std::string MusicLibrary::validate(const std::string& filePath) const {
+    std::unordered_set<std::string> claimed;
+    ImportQueue::Transfer transfer;
+    return plan(filePath, claimed, transfer);
+}
+
+std::string MusicLibrary::plan(const std::string& filePath, std::unordered_set<std::string>& claimed,
+                               ImportQueue::Transfer& transfer) const {
     if (filePath.empty() || !isSupported(filePath)) return "Unsupported file type.";
-    const std::string filename = std::filesystem::path(filePath).filename().string();
-    if (contains(filename)) return "This song already exists.";
+    std::uint64_t digest = 0;
+    if (!ContentHash::digest(filePath, digest)) return "Could not import this song.";
+
+    transfer.source = filePath;
+    std::string reason = resolve(digest, claimed, transfer);
+    if (!reason.empty()) return reason;
+    claimed.insert(transfer.object);
+    claimed.insert(transfer.destination);
     return "";
 }
 
+std::string MusicLibrary::resolve(const std::uint64_t digest, const std::unordered_set<std::string>& claimed,
+                                  ImportQueue::Transfer& transfer) const {
+    transfer.object = object(digest);
+    if (claimed.contains(transfer.object) || imports_.isPending(transfer.object) || isStored(transfer.object)) {
+        return "This song already exists.";
+    }
+
+    const std::filesystem::path source(transfer.source);
+    for (int copy = 0;; copy++) {
+        const std::string filename = copy == 0
+            ? source.filename().string()
+            : source.stem().string() + " (" + std::to_string(copy) + ")" + source.extension().string();
+        transfer.destination = (std::filesystem::path(music_path_) / filename).string();
+        if (claimed.contains(transfer.destination) || imports_.isPending(transfer.destination)) continue;
+        if (!contains(filename)) break;
+        std::uint64_t existing = 0;
+        if (ContentHash::digest(transfer.destination, existing) && existing == digest) {
+            return "This song already exists.";
+        }
+    }
+    return "";
+}
+
+std::string MusicLibrary::entry(const std::string& path) const {
+    const std::size_t slash = path.rfind('/');
+    if (slash != music_path_.size() || !path.starts_with(music_path_)) return "";
+    return path.substr(slash + 1);
+}
+
+std::vector<std::string> MusicLibrary::entries(const std::vector<std::string>& paths) const {
+    std::vector<std::string> names;
+    for (const auto& path : paths) {
+        std::string name = entry(path);
+        if (!name.empty()) names.push_back(std::move(name));
+    }
+    return names;
+}
+
 std::string MusicLibrary::insert(const std::string& filePath, Playlist& playlist) const {
-    const std::string reason = validate(filePath);
+    std::unordered_set<std::string> claimed;
+    ImportQueue::Transfer transfer;
+    const std::string reason = plan(filePath, claimed, transfer);
     if (!reason.empty()) return reason;
-    playlist.add(import(filePath));
+    const std::optional<Song> song = import(transfer);
+    if (!song) return "Could not import this song.";
+    playlist.add(*song);
     return "";
 }
 
-Song MusicLibrary::import(const std::string& sourcePath) const {
-    const std::filesystem::path source(sourcePath);
-    const std::string filename = source.filename().string();
-    const std::filesystem::path destination = std::filesystem::path(music_path_) / filename;
+std::optional<Song> MusicLibrary::import(const std::string& sourcePath) const {
+    std::unordered_set<std::string> claimed;
+    ImportQueue::Transfer transfer;
+    if (!plan(sourcePath, claimed, transfer).empty()) return std::nullopt;
+    return import(transfer);
+}
 
-    if (!std::filesystem::exists(destination)) {
-        std::filesystem::copy_file(source, destination);
+std::optional<Song> MusicLibrary::import(const ImportQueue::Transfer& transfer) const {
+    if (!FileTransfer::store(transfer.source, transfer.object, transfer.destination, [](int) { return true; })) {
+        return std::nullopt;
     }
+    MetadataCache::shared().refresh(transfer.destination);
+    const std::string filename = entry(transfer.destination);
+    names_.insert(filename);
+    return Song(filename, transfer.destination);
+}
 
-    return Song(filename, destination.string());
+std::vector<ImportQueue::Transfer> MusicLibrary::admit(const std::vector<std::string>& filePaths,
+                                                       std::vector<std::string>& reasons) const {
+    std::vector<ImportQueue::Transfer> accepted;
+    std::unordered_set<std::string> claimed;
+    for (const auto& filePath : filePaths) {
+        ImportQueue::Transfer transfer;
+        std::string reason = plan(filePath, claimed, transfer);
+        if (reason.empty()) {
+            accepted.push_back(std::move(transfer));
+        } else {
+            reasons.push_back(std::move(reason));
+        }
+    }
+    return accepted;
+}
+
+void MusicLibrary::enqueue(const std::vector<std::string>& sources, const ImportQueue::Progress& progress,
+                           const ImportQueue::Completion& completion) {
+    const auto plan = [this](ImportQueue::Transfer& transfer, const std::uint64_t digest) {
+        return resolve(digest, {}, transfer);
+    };
+    imports_.submit(sources, plan, progress, [this, completion](const std::vector<std::string>& committed,
+                                                                const std::vector<std::string>& rejected,
+                                                                const int failed) {
+        MetadataCache& cache = MetadataCache::shared();
+        for (const auto& destination : committed) {
+            cache.refresh(destination);
+            names_.insert(entry(destination));
+        }
+        completion(committed, rejected, failed);
+    });
 }
 
 void MusicLibrary::erase(const std::string& path) {
+    std::error_code error;
+    if (const std::string object = stored(path); !object.empty()) std::filesystem::remove(object, error);
     std::filesystem::remove(path);
+    MetadataCache::shared().forget(path);
+    names_.erase(entry(path));
+}
+
+void MusicLibrary::prune() {
+    std::error_code error;
+    for (std::filesystem::directory_iterator it(objects(), error), end; !error && it != end; it.increment(error)) {
+        const std::string object = it->path().string();
+        if (object.ends_with(".part") || isStored(object) || imports_.isPending(object)) continue;
+        std::error_code removal;
+        std::filesystem::remove(object, removal);
+    }
 }
 
 void MusicLibrary::visit(const std::string&, const std::string& path) {
@@ -62,12 +276,37 @@ void MusicLibrary::visit(const std::string&, const std::string& path) {
 }
 
 bool MusicLibrary::contains(const std::string& filename) const {
+    if (names_.isReady() && !names_.contains(filename)) return false;
     const std::filesystem::path destination = std::filesystem::path(music_path_) / filename;
-    return std::filesystem::exists(destination);
+    if (std::filesystem::exists(destination)) return true;
+    names_.erase(filename);
+    return false;
 }
 
 bool MusicLibrary::isSupported(const std::string& fileName) {
     const std::filesystem::path path(fileName);
     const std::string extension = path.extension().string();
     return extension == ".mp3" || extension == ".wav";
-}
\ No newline at end of file
+}
+
+std::vector<std::string> MusicLibrary::screen(const std::vector<std::string>& filePaths,
+                                             std::vector<std::string>& reasons) {
+    std::vector<std::string> supported;
+    for (const auto& filePath : filePaths) {
+        if (!filePath.empty() && isSupported(filePath)) {
+            supported.push_back(filePath);
+        } else {
+            reasons.emplace_back("Unsupported file type.");
+        }
+    }
+    return supported;
+}
+
+std::vector<Song> MusicLibrary::describe(const std::vector<std::string>& paths) {
+    std::vector<Song> songs;
+    songs.reserve(paths.size());
+    for (const auto& path : paths) {
+        songs.emplace_back(path.substr(path.rfind('/') + 1), path);
+    }
+    return songs;
+}
@@ -3,26 +3,61 @@
 
 #include "model/core/Song.h"
 #include "model/events/IPlaylistVisitor.h"
+#include "model/library/DirectoryWatcher.h"
+#include "model/library/LibraryChange.h"
+#include "model/library/ImportQueue.h"
+#include "model/library/NameIndex.h"
+#include <cstdint>
 #include <string>
+#include <unordered_set>
 #include <vector>
+#include <functional>
+#include <optional>
 #include "model/core/Playlist.h"
 
 class MusicLibrary final : public IPlaylistVisitor {
 private:
     std::string music_path_;
+    DirectoryWatcher watcher_;
+    ImportQueue imports_;
+    mutable NameIndex names_;
+
+    std::string catalog() const;
+    std::string object(std::uint64_t digest) const;
+    std::string objects() const;
+    std::string stored(const std::string& path) const;
+    bool isStored(const std::string& object) const;
+    std::string plan(const std::string& filePath, std::unordered_set<std::string>& claimed,
+                     ImportQueue::Transfer& transfer) const;
+    std::string resolve(std::uint64_t digest, const std::unordered_set<std::string>& claimed,
+                        ImportQueue::Transfer& transfer) const;
+    std::string entry(const std::string& path) const;
+    std::vector<std::string> entries(const std::vector<std::string>& paths) const;
+    LibraryChange survey(const std::vector<std::string>& paths) const;
 
 public:
     explicit MusicLibrary(const std::string& musicPath);
+    ~MusicLibrary() override;
 
     std::vector<Song> load() const;
+    void stream(const std::function<void(const std::vector<Song>&)>& consumer) const;
+    void watch(const std::function<void(const LibraryChange&)>& consumer);
     std::string validate(const std::string& filePath) const;
     std::string insert(const std::string& filePath, Playlist& playlist) const;
-    Song import(const std::string& sourcePath) const;
-    static void erase(const std::string& path);
+    std::optional<Song> import(const std::string& sourcePath) const;
+    std::optional<Song> import(const ImportQueue::Transfer& transfer) const;
+    std::vector<ImportQueue::Transfer> admit(const std::vector<std::string>& filePaths,
+                                             std::vector<std::string>& reasons) const;
+    void enqueue(const std::vector<std::string>& sources, const ImportQueue::Progress& progress,
+                 const ImportQueue::Completion& completion);
+    void erase(const std::string& path);
+    void prune();
     void visit(const std::string& name, const std::string& path) override;
     bool contains(const std::string& filename) const;
     static std::vector<std::string> scan(const std::string& directory);
     static bool isSupported(const std::string& fileName);
+    static std::vector<std::string> screen(const std::vector<std::string>& filePaths, std::vector<std::string>& reasons);
+    static std::vector<Song> describe(const std::vector<std::string>& paths);
 };
 
-#endif //MUSIC_LIBRARY_H
\ No newline at end of file
+#endif //MUSIC_LIBRARY_H
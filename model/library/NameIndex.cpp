@@ -0,0 +1,30 @@
+#include "model/library/NameIndex.h"
+
+void NameIndex::reset(const std::vector<std::string>& names) {
+    std::lock_guard lock(mutex_);
+    names_.clear();
+    names_.reserve(names.size());
+    names_.insert(names.begin(), names.end());
+    ready_ = true;
+}
+
+void NameIndex::insert(const std::string& name) {
+    if (name.empty()) return;
+    std::lock_guard lock(mutex_);
+    names_.insert(name);
+}
+
+void NameIndex::erase(const std::string& name) {
+    std::lock_guard lock(mutex_);
+    names_.erase(name);
+}
+
+bool NameIndex::isReady() const {
+    std::lock_guard lock(mutex_);
+    return ready_;
+}
+
+bool NameIndex::contains(const std::string& name) const {
+    std::lock_guard lock(mutex_);
+    return names_.contains(name);
+}
@@ -0,0 +1,23 @@
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class NameIndex {
+private:
+    mutable std::mutex mutex_;
+    std::unordered_set<std::string> names_;
+    bool ready_ = false;
+
+public:
+    void reset(const std::vector<std::string>& names);
+    void insert(const std::string& name);
+    void erase(const std::string& name);
+    bool isReady() const;
+    bool contains(const std::string& name) const;
+};
+
+#endif //NAME_INDEX_H
@@ -13,4 +13,32 @@ void DirectoryTestFixture::TearDown() {
 
 void DirectoryTestFixture::createFile(const std::string& name) const {
     std::ofstream(test_directory_ + "/" + name).close();
+}
+
+std::string DirectoryTestFixture::writeFile(const std::string& name, const std::string_view content) const {
+    const std::string path = test_directory_ + "/" + name;
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(content.data(), static_cast<std::streamsize>(content.size()));
+    return path;
+}
+
+std::string DirectoryTestFixture::writeFile(const std::string& name, const std::vector<std::uint8_t>& bytes) const {
+    return writeFile(name, std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+}
+
+std::string DirectoryTestFixture::pattern(const std::size_t size) {
+    std::string content(size, '\0');
+    for (std::size_t i = 0; i < size; i++) {
+        content[i] = static_cast<char>(i * 31 % 251);
+    }
+    return content;
+}
+
+void DirectoryTestFixture::append(std::vector<std::uint8_t>& bytes, const std::string& text) {
+    bytes.insert(bytes.end(), text.begin(), text.end());
+}
+
+void DirectoryTestFixture::appendLittle(std::vector<std::uint8_t>& bytes, const std::uint32_t value, const int width) {
+    for (int i = 0; i < width; i++) {
+        bytes.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
 }
\ No newline at end of file
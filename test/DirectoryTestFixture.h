@@ -2,7 +2,10 @@
 #define DIRECTORY_TEST_FIXTURE_H
 
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 class DirectoryTestFixture : public ::testing::Test {
 protected:
@@ -11,6 +14,12 @@ protected:
     void SetUp() override;
     void TearDown() override;
     void createFile(const std::string& name) const;
+    std::string writeFile(const std::string& name, std::string_view content) const;
+    std::string writeFile(const std::string& name, const std::vector<std::uint8_t>& bytes) const;
+
+    static std::string pattern(std::size_t size);
+    static void append(std::vector<std::uint8_t>& bytes, const std::string& text);
+    static void appendLittle(std::vector<std::uint8_t>& bytes, std::uint32_t value, int width = 4);
 
     virtual std::string identify() const = 0;
 };
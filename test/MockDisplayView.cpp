@@ -0,0 +1,43 @@
+#include "MockDisplayView.h"
+
+void MockDisplayView::refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) {
+    calls_.push_back("refresh");
+    snapshots_.push_back(std::move(playlist));
+}
+
+void MockDisplayView::insert(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                             const std::size_t count) {
+    calls_.push_back("insert " + std::to_string(first) + " " + std::to_string(count));
+    snapshots_.push_back(std::move(playlist));
+}
+
+void MockDisplayView::erase(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::size_t first,
+                            const std::size_t count) {
+    calls_.push_back("erase " + std::to_string(first) + " " + std::to_string(count));
+    snapshots_.push_back(std::move(playlist));
+}
+
+void MockDisplayView::reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) {
+    std::string call = "reorder";
+    for (const std::size_t row : order) {
+        call += " " + std::to_string(row);
+    }
+    calls_.push_back(call);
+    snapshots_.push_back(std::move(playlist));
+}
+
+void MockDisplayView::highlight(int) {}
+
+void MockDisplayView::suggest(const std::vector<std::string>&) {}
+
+void MockDisplayView::dismiss() {}
+
+void MockDisplayView::sort(const std::string&) {}
+
+const std::vector<std::string>& MockDisplayView::calls() const {
+    return calls_;
+}
+
+const std::vector<std::shared_ptr<const IPlaylistSnapshot>>& MockDisplayView::snapshots() const {
+    return snapshots_;
+}
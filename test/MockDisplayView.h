@@ -0,0 +1,28 @@
+#ifndef MOCK_DISPLAY_VIEW_H
+#define MOCK_DISPLAY_VIEW_H
+
+#include "view/IDisplayView.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class MockDisplayView final : public IDisplayView {
+private:
+    std::vector<std::string> calls_;
+    std::vector<std::shared_ptr<const IPlaylistSnapshot>> snapshots_;
+
+public:
+    void refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) override;
+    void insert(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) override;
+    void erase(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) override;
+    void reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) override;
+    void highlight(int index) override;
+    void suggest(const std::vector<std::string>& names) override;
+    void dismiss() override;
+    void sort(const std::string& label) override;
+
+    const std::vector<std::string>& calls() const;
+    const std::vector<std::shared_ptr<const IPlaylistSnapshot>>& snapshots() const;
+};
+
+#endif //MOCK_DISPLAY_VIEW_H
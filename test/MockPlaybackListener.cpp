@@ -1,16 +1,24 @@
 #include "MockPlaybackListener.h"
 #include <algorithm>
+#include <stdexcept>
 
 void MockPlaybackListener::onStart(const std::string& path) {
     starts_.push_back(path);
+    history_.push_back("start " + path);
 }
 
 void MockPlaybackListener::onChanged() {
     changes_++;
+    if (failing_) throw std::logic_error("listener failed");
+}
+
+void MockPlaybackListener::onDelta(const PlaylistDelta& delta) {
+    steps_.insert(steps_.end(), delta.steps().begin(), delta.steps().end());
 }
 
 void MockPlaybackListener::onSelected(const int index) {
     selections_.push_back(index);
+    history_.push_back("select " + std::to_string(index));
 }
 
 void MockPlaybackListener::onEnabled(bool) {
@@ -33,10 +41,22 @@ void MockPlaybackListener::onFeedback(const std::string& message, bool) {
     feedbacks_.push_back(message);
 }
 
+void MockPlaybackListener::onProgress(const std::string&, const int percent) {
+    progress_.push_back(percent);
+}
+
 void MockPlaybackListener::onStopped() {
     stops_++;
 }
 
+void MockPlaybackListener::fail() {
+    failing_ = true;
+}
+
+const std::vector<std::string>& MockPlaybackListener::history() const {
+    return history_;
+}
+
 bool MockPlaybackListener::wasStarted() const {
     return !starts_.empty();
 }
@@ -53,6 +73,24 @@ bool MockPlaybackListener::wasChangedTimes(const int expected) const {
     return changes_ == expected;
 }
 
+bool MockPlaybackListener::wasInserted(const std::size_t first, const std::size_t count) const {
+    return std::ranges::any_of(steps_, [&](const PlaylistDelta::Step& step) {
+        return step.kind == PlaylistDelta::Kind::Inserted && step.first == first && step.count == count;
+    });
+}
+
+bool MockPlaybackListener::wasRemoved(const std::size_t first, const std::size_t count) const {
+    return std::ranges::any_of(steps_, [&](const PlaylistDelta::Step& step) {
+        return step.kind == PlaylistDelta::Kind::Removed && step.first == first && step.count == count;
+    });
+}
+
+bool MockPlaybackListener::wasMoved(const std::vector<std::size_t>& order) const {
+    return std::ranges::any_of(steps_, [&](const PlaylistDelta::Step& step) {
+        return step.kind == PlaylistDelta::Kind::Moved && step.order == order;
+    });
+}
+
 bool MockPlaybackListener::wasSelected() const {
     return !selections_.empty();
 }
@@ -77,6 +115,10 @@ bool MockPlaybackListener::wasFeedback(const std::string& message) const {
     return std::ranges::find(feedbacks_, message) != feedbacks_.end();
 }
 
+bool MockPlaybackListener::wasProgressedTo(const int percent) const {
+    return std::ranges::find(progress_, percent) != progress_.end();
+}
+
 bool MockPlaybackListener::wasStopped() const {
     return stops_ > 0;
 }
\ No newline at end of file
@@ -10,15 +10,20 @@ private:
     std::vector<std::string> starts_;
     std::vector<int> selections_;
     std::vector<std::string> feedbacks_;
+    std::vector<int> progress_;
+    std::vector<PlaylistDelta::Step> steps_;
+    std::vector<std::string> history_;
     int changes_ = 0;
     int enables_ = 0;
     int reveals_ = 0;
     int cancels_ = 0;
     int stops_ = 0;
+    bool failing_ = false;
 
 public:
     void onStart(const std::string& path) override;
     void onChanged() override;
+    void onDelta(const PlaylistDelta& delta) override;
     void onSelected(int index) override;
     void onEnabled(bool state) override;
     void onReveal(bool visible) override;
@@ -26,18 +31,25 @@ public:
     void onCancel() override;
     void onRepeatChanged(int mode) override;
     void onFeedback(const std::string& message, bool success) override;
+    void onProgress(const std::string& name, int percent) override;
     void onStopped() override;
 
+    void fail();
+    const std::vector<std::string>& history() const;
     bool wasStarted() const;
     bool wasStartedWith(const std::string& path) const;
     bool wasChanged() const;
     bool wasChangedTimes(int expected) const;
+    bool wasInserted(std::size_t first, std::size_t count) const;
+    bool wasRemoved(std::size_t first, std::size_t count) const;
+    bool wasMoved(const std::vector<std::size_t>& order) const;
     bool wasSelected() const;
     bool wasSelectedWith(int index) const;
     bool wasEnabled() const;
     bool wasRevealed() const;
     bool wasCancelled() const;
     bool wasFeedback(const std::string& message) const;
+    bool wasProgressedTo(int percent) const;
     bool wasStopped() const;
 };
 
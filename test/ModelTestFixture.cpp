@@ -15,7 +15,7 @@ void ModelTestFixture::TearDown() {
 }
 
 void ModelTestFixture::createSong(const std::string& name) const {
-    std::ofstream(music_directory_ + "/" + name) << "audio";
+    std::ofstream(music_directory_ + "/" + name) << "audio " << name;
 }
 
 void ModelTestFixture::createAd(const std::string& name) const {
@@ -0,0 +1,31 @@
+#include "QueuedEventLoop.h"
+#include <chrono>
+#include <thread>
+
+void QueuedEventLoop::post(std::function<void()> task) {
+    std::lock_guard lock(mutex_);
+    tasks_.push_back(std::move(task));
+}
+
+bool QueuedEventLoop::awaits() {
+    for (int attempt = 0; attempt < 200; attempt++) {
+        {
+            std::lock_guard lock(mutex_);
+            if (!tasks_.empty()) return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+int QueuedEventLoop::drain() {
+    std::deque<std::function<void()>> tasks;
+    {
+        std::lock_guard lock(mutex_);
+        tasks.swap(tasks_);
+    }
+    for (const auto& task : tasks) {
+        task();
+    }
+    return static_cast<int>(tasks.size());
+}
@@ -0,0 +1,20 @@
+#ifndef QUEUED_EVENT_LOOP_H
+#define QUEUED_EVENT_LOOP_H
+
+#include "model/events/IEventLoop.h"
+#include <deque>
+#include <mutex>
+
+class QueuedEventLoop final : public IEventLoop {
+private:
+    std::mutex mutex_;
+    std::deque<std::function<void()>> tasks_;
+
+public:
+    void post(std::function<void()> task) override;
+
+    bool awaits();
+    int drain();
+};
+
+#endif //QUEUED_EVENT_LOOP_H
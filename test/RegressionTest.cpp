@@ -126,7 +126,7 @@ TEST_F(RegressionTest, InsertDuplicateGivesFeedback) {
     createSong("dup.mp3");
     std::string srcDir = base_directory_ + "/src";
     std::filesystem::create_directories(srcDir);
-    std::ofstream(srcDir + "/dup.mp3") << "data";
+    std::ofstream(srcDir + "/dup.mp3") << "audio dup.mp3";
 
     MusicPlayer musicPlayer(base_directory_, ad_policy_);
     MockPlaybackListener listener_;
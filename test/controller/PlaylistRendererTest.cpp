@@ -0,0 +1,38 @@
+#include "PlaylistRendererTest.h"
+
+TEST_F(PlaylistRendererTest, RenderRefreshesWholePlaylist) {
+    renderer_.render(songs_);
+    ASSERT_EQ(std::vector<std::string>{"refresh"}, view_.calls());
+    EXPECT_EQ(3, view_.snapshots()[0]->size());
+}
+
+TEST_F(PlaylistRendererTest, EmptyDeltaRendersNothing) {
+    renderer_.render(songs_, PlaylistDelta());
+    EXPECT_TRUE(view_.calls().empty());
+}
+
+TEST_F(PlaylistRendererTest, DeltaStepsReachViewInOrder) {
+    PlaylistDelta delta;
+    delta.remove(0);
+    delta.insert(2);
+    delta.insert(3);
+    renderer_.render(songs_, delta);
+    EXPECT_EQ((std::vector<std::string>{"erase 0 1", "insert 2 2"}), view_.calls());
+}
+
+TEST_F(PlaylistRendererTest, DeltaStepsShareOneSnapshot) {
+    PlaylistDelta delta;
+    delta.remove(0);
+    delta.insert(2);
+    renderer_.render(songs_, delta);
+    ASSERT_EQ(2, view_.snapshots().size());
+    EXPECT_EQ(view_.snapshots()[0], view_.snapshots()[1]);
+    EXPECT_EQ("c.mp3", view_.snapshots()[1]->name(2));
+}
+
+TEST_F(PlaylistRendererTest, MoveReachesViewAsReorder) {
+    PlaylistDelta delta;
+    delta.move({2, 0, 1});
+    renderer_.render(songs_, delta);
+    EXPECT_EQ(std::vector<std::string>{"reorder 2 0 1"}, view_.calls());
+}
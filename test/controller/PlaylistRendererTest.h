@@ -0,0 +1,20 @@
+#ifndef PLAYLIST_RENDERER_TEST_H
+#define PLAYLIST_RENDERER_TEST_H
+
+#include <gtest/gtest.h>
+#include "controller/PlaylistRenderer.h"
+#include "../MockDisplayView.h"
+#include <vector>
+
+class PlaylistRendererTest : public ::testing::Test {
+protected:
+    MockDisplayView view_;
+    PlaylistRenderer renderer_{view_};
+    std::vector<Song> songs_{
+        Song("a.mp3", "/music/a.mp3"),
+        Song("b.mp3", "/music/b.mp3"),
+        Song("c.mp3", "/music/c.mp3"),
+    };
+};
+
+#endif //PLAYLIST_RENDERER_TEST_H
@@ -0,0 +1,24 @@
+#include "PlaylistSnapshotTest.h"
+#include "controller/PlaylistSnapshot.h"
+
+TEST_F(PlaylistSnapshotTest, EmptyPlaylistHasNoRows) {
+    const PlaylistSnapshot snapshot({});
+    EXPECT_EQ(0, snapshot.size());
+}
+
+TEST_F(PlaylistSnapshotTest, ExposesRowsInPlaylistOrder) {
+    const PlaylistSnapshot snapshot(songs_);
+    ASSERT_EQ(3, snapshot.size());
+    EXPECT_EQ("a.mp3", snapshot.name(0));
+    EXPECT_EQ("c.mp3", snapshot.name(2));
+    EXPECT_EQ(songs_[1].id(), snapshot.id(1));
+}
+
+TEST_F(PlaylistSnapshotTest, OutlivesPlaylistChanges) {
+    const PlaylistSnapshot snapshot(songs_);
+    songs_.erase(songs_.begin());
+    songs_.emplace_back("d.mp3", "/music/d.mp3");
+    ASSERT_EQ(3, snapshot.size());
+    EXPECT_EQ("a.mp3", snapshot.name(0));
+    EXPECT_EQ("c.mp3", snapshot.name(2));
+}
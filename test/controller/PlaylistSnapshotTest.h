@@ -0,0 +1,17 @@
+#ifndef PLAYLIST_SNAPSHOT_TEST_H
+#define PLAYLIST_SNAPSHOT_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/core/Song.h"
+#include <vector>
+
+class PlaylistSnapshotTest : public ::testing::Test {
+protected:
+    std::vector<Song> songs_{
+        Song("a.mp3", "/music/a.mp3"),
+        Song("b.mp3", "/music/b.mp3"),
+        Song("c.mp3", "/music/c.mp3"),
+    };
+};
+
+#endif //PLAYLIST_SNAPSHOT_TEST_H
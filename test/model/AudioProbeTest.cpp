@@ -0,0 +1,106 @@
+#include "AudioProbeTest.h"
+#include "model/core/AudioProbe.h"
+
+std::string AudioProbeTest::identify() const {
+    return "audio_probe_test";
+}
+
+std::vector<std::uint8_t> AudioProbeTest::wave(const int byteRate, const int dataSize, const bool annotated) {
+    std::vector<std::uint8_t> bytes;
+    append(bytes, "RIFF");
+    appendLittle(bytes, 0, 4);
+    append(bytes, "WAVE");
+    if (annotated) {
+        append(bytes, "LIST");
+        appendLittle(bytes, 5, 4);
+        append(bytes, "notes");
+        bytes.push_back(0);
+    }
+    append(bytes, "fmt ");
+    appendLittle(bytes, 16, 4);
+    appendLittle(bytes, 1, 2);
+    appendLittle(bytes, 1, 2);
+    appendLittle(bytes, byteRate, 4);
+    appendLittle(bytes, byteRate, 4);
+    appendLittle(bytes, 1, 2);
+    appendLittle(bytes, 8, 2);
+    append(bytes, "data");
+    appendLittle(bytes, dataSize, 4);
+    bytes.resize(bytes.size() + dataSize, 0x80);
+    return bytes;
+}
+
+std::vector<std::uint8_t> AudioProbeTest::frame(const std::string& marker, const int offset, const std::uint32_t frames) {
+    std::vector<std::uint8_t> bytes = {0xFF, 0xFB, 0x90, 0x00};
+    bytes.resize(417, 0);
+    if (!marker.empty()) {
+        std::copy(marker.begin(), marker.end(), bytes.begin() + offset);
+        if (marker == "VBRI") {
+            placeBig(bytes, offset + 14, frames);
+        } else {
+            placeBig(bytes, offset + 4, 1);
+            placeBig(bytes, offset + 8, frames);
+        }
+    }
+    return bytes;
+}
+
+void AudioProbeTest::placeBig(std::vector<std::uint8_t>& bytes, const std::size_t offset, const std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        bytes[offset + i] = static_cast<std::uint8_t>(value >> (24 - 8 * i));
+    }
+}
+
+TEST_F(AudioProbeTest, MeasureReturnsZeroForMissingFile) {
+    EXPECT_EQ(0, AudioProbe::measure(test_directory_ + "/missing.mp3"));
+}
+
+TEST_F(AudioProbeTest, MeasureReturnsZeroForEmptyFile) {
+    createFile("empty.mp3");
+    EXPECT_EQ(0, AudioProbe::measure(test_directory_ + "/empty.mp3"));
+}
+
+TEST_F(AudioProbeTest, MeasureWaveFromDataChunk) {
+    EXPECT_EQ(1000, AudioProbe::measure(writeFile("song.wav", wave(8000, 8000))));
+}
+
+TEST_F(AudioProbeTest, MeasureWaveHonoursByteRate) {
+    EXPECT_EQ(250, AudioProbe::measure(writeFile("song.wav", wave(32000, 8000))));
+}
+
+TEST_F(AudioProbeTest, MeasureWaveSkipsUnknownChunks) {
+    EXPECT_EQ(500, AudioProbe::measure(writeFile("song.wav", wave(8000, 4000, true))));
+}
+
+TEST_F(AudioProbeTest, MeasureMpegFromXingFrameCount) {
+    EXPECT_EQ(26122, AudioProbe::measure(writeFile("song.mp3", frame("Xing", 36, 1000))));
+}
+
+TEST_F(AudioProbeTest, MeasureMpegFromInfoFrameCount) {
+    EXPECT_EQ(2612, AudioProbe::measure(writeFile("song.mp3", frame("Info", 36, 100))));
+}
+
+TEST_F(AudioProbeTest, MeasureMpegFromVbriFrameCount) {
+    EXPECT_EQ(13061, AudioProbe::measure(writeFile("song.mp3", frame("VBRI", 36, 500))));
+}
+
+TEST_F(AudioProbeTest, MeasureMpegSkipsId3Tag) {
+    std::vector<std::uint8_t> bytes = {'I', 'D', '3', 4, 0, 0, 0, 0, 0, 100};
+    bytes.resize(110, 0);
+    const std::vector<std::uint8_t> xing = frame("Xing", 36, 1000);
+    bytes.insert(bytes.end(), xing.begin(), xing.end());
+    EXPECT_EQ(26122, AudioProbe::measure(writeFile("song.mp3", bytes)));
+}
+
+TEST_F(AudioProbeTest, MeasureMpegWalksFramesWithoutHeader) {
+    std::vector<std::uint8_t> bytes;
+    for (int i = 0; i < 20; i++) {
+        const std::vector<std::uint8_t> plain = frame();
+        bytes.insert(bytes.end(), plain.begin(), plain.end());
+    }
+    EXPECT_EQ(521, AudioProbe::measure(writeFile("song.mp3", bytes)));
+}
+
+TEST_F(AudioProbeTest, MeasureUnknownContentEstimatesFromSize) {
+    EXPECT_EQ(1000, AudioProbe::measure(writeFile("song.mp3", std::vector<std::uint8_t>(16000, 'x'))));
+}
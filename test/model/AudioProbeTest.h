@@ -0,0 +1,17 @@
+#ifndef AUDIO_PROBE_TEST_H
+#define AUDIO_PROBE_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class AudioProbeTest : public DirectoryTestFixture {
+protected:
+    std::string identify() const override;
+    static std::vector<std::uint8_t> wave(int byteRate, int dataSize, bool annotated = false);
+    static std::vector<std::uint8_t> frame(const std::string& marker = "", int offset = 36, std::uint32_t frames = 0);
+    static void placeBig(std::vector<std::uint8_t>& bytes, std::size_t offset, std::uint32_t value);
+};
+
+#endif //AUDIO_PROBE_TEST_H
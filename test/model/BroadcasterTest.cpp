@@ -0,0 +1,26 @@
+#include "BroadcasterTest.h"
+
+TEST_F(BroadcasterTest, NotifiesWithoutListeners) {
+    EXPECT_NO_THROW(broadcaster_.notify<&IPlaybackListener::onChanged>());
+}
+
+TEST_F(BroadcasterTest, NotifiesEveryListener) {
+    broadcaster_.add(first_);
+    broadcaster_.add(second_);
+    broadcaster_.notify<&IPlaybackListener::onSelected>(3);
+    EXPECT_TRUE(first_.wasSelectedWith(3));
+    EXPECT_TRUE(second_.wasSelectedWith(3));
+}
+
+TEST_F(BroadcasterTest, ForwardsEveryArgument) {
+    broadcaster_.add(first_);
+    broadcaster_.notify<&IPlaybackListener::onFeedback>(std::string("Saved"), true);
+    EXPECT_TRUE(first_.wasFeedback("Saved"));
+}
+
+TEST_F(BroadcasterTest, NotifiesListenerOncePerEvent) {
+    broadcaster_.add(first_);
+    broadcaster_.notify<&IPlaybackListener::onChanged>();
+    broadcaster_.notify<&IPlaybackListener::onChanged>();
+    EXPECT_TRUE(first_.wasChangedTimes(2));
+}
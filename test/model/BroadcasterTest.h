@@ -0,0 +1,15 @@
+#ifndef BROADCASTER_TEST_H
+#define BROADCASTER_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/events/Broadcaster.h"
+#include "../MockPlaybackListener.h"
+
+class BroadcasterTest : public ::testing::Test {
+protected:
+    Broadcaster<IPlaybackListener> broadcaster_;
+    MockPlaybackListener first_;
+    MockPlaybackListener second_;
+};
+
+#endif //BROADCASTER_TEST_H
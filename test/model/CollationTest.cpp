@@ -0,0 +1,38 @@
+#include "CollationTest.h"
+
+TEST_F(CollationTest, OrdersNumbersNaturally) {
+    EXPECT_LT(Collation::key("Track 2.mp3"), Collation::key("Track 10.mp3"));
+    EXPECT_LT(Collation::key("Track 9.mp3"), Collation::key("Track 10.mp3"));
+}
+
+TEST_F(CollationTest, IgnoresLeadingZeros) {
+    EXPECT_EQ(Collation::key("Track 007.mp3"), Collation::key("Track 7.mp3"));
+    EXPECT_LT(Collation::key("Track 0.mp3"), Collation::key("Track 1.mp3"));
+}
+
+TEST_F(CollationTest, FoldsCase) {
+    EXPECT_EQ(Collation::key("ABBA Gold.mp3"), Collation::key("abba gold.mp3"));
+    EXPECT_LT(Collation::key("apple.mp3"), Collation::key("Banana.mp3"));
+}
+
+TEST_F(CollationTest, FoldsLatinAccents) {
+    EXPECT_EQ(Collation::key("Beyonc\xc3\xa9.mp3"), Collation::key("beyonce.mp3"));
+    EXPECT_EQ(Collation::key("\xc3\x89t\xc3\xa9.mp3"), Collation::key("ete.mp3"));
+    EXPECT_LT(Collation::key("\xc3\x89t\xc3\xa9.mp3"), Collation::key("Fall.mp3"));
+}
+
+TEST_F(CollationTest, ExpandsLigatures) {
+    EXPECT_EQ(Collation::key("Stra\xc3\x9f" "e.mp3"), Collation::key("strasse.mp3"));
+}
+
+TEST_F(CollationTest, CollapsesWhitespace) {
+    EXPECT_EQ(Collation::key("Blue  \tMoon.mp3"), Collation::key("Blue Moon.mp3"));
+}
+
+TEST_F(CollationTest, KeepsOtherTextIntact) {
+    EXPECT_EQ("\xe6\x97\xa5\xe6\x9c\xac.wav", Collation::key("\xe6\x97\xa5\xe6\x9c\xac.wav"));
+}
+
+TEST_F(CollationTest, EmptyTextHasEmptyKey) {
+    EXPECT_EQ("", Collation::key(""));
+}
@@ -0,0 +1,10 @@
+#ifndef COLLATION_TEST_H
+#define COLLATION_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/core/Collation.h"
+
+class CollationTest : public ::testing::Test {
+};
+
+#endif //COLLATION_TEST_H
@@ -0,0 +1,51 @@
+#include "ContentHashTest.h"
+#include "model/library/ContentHash.h"
+
+std::string ContentHashTest::identify() const {
+    return "content_hash_test";
+}
+
+TEST_F(ContentHashTest, HashMatchesReferenceVectors) {
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, ContentHash::hash(""));
+    EXPECT_EQ(0xD24EC4F1A98C6E5BULL, ContentHash::hash("a"));
+    EXPECT_EQ(0x44BC2CF5AD770999ULL, ContentHash::hash("abc"));
+}
+
+TEST_F(ContentHashTest, IdenticalFilesShareDigest) {
+    std::uint64_t first = 0;
+    std::uint64_t second = 0;
+    ASSERT_TRUE(ContentHash::digest(writeFile("a.mp3", "same audio"), first));
+    ASSERT_TRUE(ContentHash::digest(writeFile("b.mp3", "same audio"), second));
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(ContentHashTest, DifferentFilesDiffer) {
+    std::uint64_t first = 0;
+    std::uint64_t second = 0;
+    ASSERT_TRUE(ContentHash::digest(writeFile("a.mp3", "one"), first));
+    ASSERT_TRUE(ContentHash::digest(writeFile("b.mp3", "two"), second));
+    EXPECT_NE(first, second);
+}
+
+TEST_F(ContentHashTest, FileDigestMatchesContentDigest) {
+    const std::string content = pattern(9 * 1024 * 1024 + 17);
+    std::uint64_t digest = 0;
+    ASSERT_TRUE(ContentHash::digest(writeFile("large.mp3", content), digest));
+    EXPECT_EQ(ContentHash::digest(content), digest);
+}
+
+TEST_F(ContentHashTest, EmptyFileHasDigest) {
+    std::uint64_t digest = 0;
+    ASSERT_TRUE(ContentHash::digest(writeFile("empty.mp3", ""), digest));
+    EXPECT_EQ(ContentHash::digest(std::string_view()), digest);
+}
+
+TEST_F(ContentHashTest, MissingFileFails) {
+    std::uint64_t digest = 0;
+    EXPECT_FALSE(ContentHash::digest(test_directory_ + "/missing.mp3", digest));
+}
+
+TEST_F(ContentHashTest, FormatsSixteenHexDigits) {
+    EXPECT_EQ("00000000000000ff", ContentHash::format(0xFF));
+    EXPECT_EQ("0123456789abcdef", ContentHash::format(0x0123456789ABCDEFULL));
+}
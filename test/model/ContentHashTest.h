@@ -0,0 +1,12 @@
+#ifndef CONTENT_HASH_TEST_H
+#define CONTENT_HASH_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include <string>
+
+class ContentHashTest : public DirectoryTestFixture {
+protected:
+    std::string identify() const override;
+};
+
+#endif //CONTENT_HASH_TEST_H
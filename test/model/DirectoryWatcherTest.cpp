@@ -0,0 +1,84 @@
+#include "DirectoryWatcherTest.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+std::string DirectoryWatcherTest::identify() const {
+    return "directory_watcher_test";
+}
+
+void DirectoryWatcherTest::record(const std::vector<std::string>& paths) {
+    std::lock_guard lock(mutex_);
+    changed_.insert(changed_.end(), paths.begin(), paths.end());
+}
+
+bool DirectoryWatcherTest::awaits(const std::string& path) {
+    for (int attempt = 0; attempt < 200; attempt++) {
+        {
+            std::lock_guard lock(mutex_);
+            if (std::ranges::find(changed_, path) != changed_.end()) return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+TEST_F(DirectoryWatcherTest, WatchStartsOnExistingDirectory) {
+    EXPECT_TRUE(watcher_.watch(test_directory_, [](const std::vector<std::string>&) {}));
+    EXPECT_TRUE(watcher_.isWatching());
+}
+
+TEST_F(DirectoryWatcherTest, WatchFailsOnMissingDirectory) {
+    EXPECT_FALSE(watcher_.watch("/nonexistent/directory", [](const std::vector<std::string>&) {}));
+    EXPECT_FALSE(watcher_.isWatching());
+}
+
+TEST_F(DirectoryWatcherTest, ReportsCreatedFile) {
+    watcher_.watch(test_directory_, [this](const std::vector<std::string>& paths) { record(paths); });
+    createFile("new.mp3");
+    EXPECT_TRUE(awaits(test_directory_ + "/new.mp3"));
+}
+
+TEST_F(DirectoryWatcherTest, ReportsRemovedFile) {
+    createFile("old.mp3");
+    watcher_.watch(test_directory_, [this](const std::vector<std::string>& paths) { record(paths); });
+    std::filesystem::remove(test_directory_ + "/old.mp3");
+    EXPECT_TRUE(awaits(test_directory_ + "/old.mp3"));
+}
+
+TEST_F(DirectoryWatcherTest, StopEndsWatching) {
+    watcher_.watch(test_directory_, [](const std::vector<std::string>&) {});
+    watcher_.stop();
+    EXPECT_FALSE(watcher_.isWatching());
+}
+
+TEST_F(DirectoryWatcherTest, ReportsFileInNestedFolder) {
+    std::filesystem::create_directories(test_directory_ + "/Artist/Album");
+    watcher_.watch(test_directory_, [this](const std::vector<std::string>& paths) { record(paths); });
+    createFile("Artist/Album/new.mp3");
+    EXPECT_TRUE(awaits(test_directory_ + "/Artist/Album/new.mp3"));
+}
+
+TEST_F(DirectoryWatcherTest, FollowsFolderCreatedWhileWatching) {
+    watcher_.watch(test_directory_, [this](const std::vector<std::string>& paths) { record(paths); });
+    std::filesystem::create_directories(test_directory_ + "/Album");
+    ASSERT_TRUE(awaits(test_directory_ + "/Album"));
+    createFile("Album/late.mp3");
+    EXPECT_TRUE(awaits(test_directory_ + "/Album/late.mp3"));
+}
+
+TEST_F(DirectoryWatcherTest, CoalescesRepeatedEvents) {
+    std::atomic<int> batches = 0;
+    watcher_.watch(test_directory_, [&](const std::vector<std::string>& paths) {
+        record(paths);
+        batches++;
+    });
+    for (int i = 0; i < 5; i++) {
+        createFile("same.mp3");
+    }
+    ASSERT_TRUE(awaits(test_directory_ + "/same.mp3"));
+    watcher_.stop();
+    EXPECT_EQ(1, batches.load());
+    EXPECT_EQ(1, std::ranges::count(changed_, test_directory_ + "/same.mp3"));
+}
@@ -0,0 +1,21 @@
+#ifndef DIRECTORY_WATCHER_TEST_H
+#define DIRECTORY_WATCHER_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include "model/library/DirectoryWatcher.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+class DirectoryWatcherTest : public DirectoryTestFixture {
+protected:
+    DirectoryWatcher watcher_;
+    std::mutex mutex_;
+    std::vector<std::string> changed_;
+
+    std::string identify() const override;
+    void record(const std::vector<std::string>& paths);
+    bool awaits(const std::string& path);
+};
+
+#endif //DIRECTORY_WATCHER_TEST_H
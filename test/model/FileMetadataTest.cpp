@@ -32,3 +32,13 @@ TEST_F(FileMetadataTest, LastDistinguishesFileSizes) {
     std::ofstream(large) << std::string(500, 'x');
     EXPECT_LT(FileMetadata(small).last(), FileMetadata(large).last());
 }
+
+TEST_F(FileMetadataTest, DurationReturnsZeroForMissingFile) {
+    EXPECT_EQ(0, FileMetadata("/nonexistent/path/file.mp3").duration());
+}
+
+TEST_F(FileMetadataTest, DurationEstimatesUnknownContent) {
+    const std::string path = test_directory_ + "/unknown.mp3";
+    std::ofstream(path) << std::string(32000, 'x');
+    EXPECT_EQ(2000, FileMetadata(path).duration());
+}
@@ -0,0 +1,79 @@
+#include "FileTransferTest.h"
+#include "model/library/FileTransfer.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+std::string FileTransferTest::identify() const {
+    return "file_transfer_test";
+}
+
+std::string FileTransferTest::read(const std::string& path) const {
+    std::ifstream input(path, std::ios::binary);
+    std::stringstream content;
+    content << input.rdbuf();
+    return content.str();
+}
+
+TEST_F(FileTransferTest, CopiesContent) {
+    const std::string source = writeFile("source.mp3", pattern(100000));
+    const std::string destination = test_directory_ + "/copy.mp3";
+    EXPECT_TRUE(FileTransfer::copy(source, destination, [](int) { return true; }));
+    EXPECT_EQ(read(source), read(destination));
+}
+
+TEST_F(FileTransferTest, ReportsCompletion) {
+    const std::string source = writeFile("source.mp3", pattern(1000));
+    std::vector<int> reported;
+    FileTransfer::copy(source, test_directory_ + "/copy.mp3", [&](const int percent) {
+        reported.push_back(percent);
+        return true;
+    });
+    ASSERT_FALSE(reported.empty());
+    EXPECT_EQ(100, reported.back());
+}
+
+TEST_F(FileTransferTest, CopiesEmptyFile) {
+    const std::string source = writeFile("empty.mp3", pattern(0));
+    const std::string destination = test_directory_ + "/copy.mp3";
+    EXPECT_TRUE(FileTransfer::copy(source, destination, [](int) { return true; }));
+    EXPECT_TRUE(std::filesystem::exists(destination));
+}
+
+TEST_F(FileTransferTest, LeavesNoPartialFile) {
+    const std::string source = writeFile("source.mp3", pattern(1000));
+    const std::string destination = test_directory_ + "/copy.mp3";
+    FileTransfer::copy(source, destination, [](int) { return true; });
+    EXPECT_FALSE(std::filesystem::exists(destination + ".part"));
+}
+
+TEST_F(FileTransferTest, MissingSourceFails) {
+    const std::string destination = test_directory_ + "/copy.mp3";
+    EXPECT_FALSE(FileTransfer::copy(test_directory_ + "/missing.mp3", destination, [](int) { return true; }));
+    EXPECT_FALSE(std::filesystem::exists(destination));
+}
+
+TEST_F(FileTransferTest, MissingFolderFails) {
+    const std::string source = writeFile("source.mp3", pattern(1000));
+    EXPECT_FALSE(FileTransfer::copy(source, test_directory_ + "/missing/copy.mp3", [](int) { return true; }));
+}
+
+TEST_F(FileTransferTest, StoreNeverLinksSourceIntoObjects) {
+    const std::string source = writeFile("source.mp3", pattern(1000));
+    const std::string object = test_directory_ + "/.objects/0123456789abcdef";
+    const std::string destination = test_directory_ + "/song.mp3";
+    EXPECT_TRUE(FileTransfer::store(source, object, destination, [](int) { return true; }));
+    EXPECT_EQ(1, std::filesystem::hard_link_count(source));
+    EXPECT_EQ(2, std::filesystem::hard_link_count(object));
+    EXPECT_TRUE(std::filesystem::equivalent(object, destination));
+    EXPECT_EQ(read(source), read(destination));
+}
+
+TEST_F(FileTransferTest, KeepsExistingDestination) {
+    const std::string source = writeFile("source.mp3", pattern(1000));
+    const std::string destination = writeFile("copy.mp3", pattern(10));
+    EXPECT_FALSE(FileTransfer::copy(source, destination, [](int) { return true; }));
+    EXPECT_EQ(10, std::filesystem::file_size(destination));
+    EXPECT_FALSE(std::filesystem::exists(destination + ".part"));
+}
@@ -0,0 +1,13 @@
+#ifndef FILE_TRANSFER_TEST_H
+#define FILE_TRANSFER_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include <string>
+
+class FileTransferTest : public DirectoryTestFixture {
+protected:
+    std::string identify() const override;
+    std::string read(const std::string& path) const;
+};
+
+#endif //FILE_TRANSFER_TEST_H
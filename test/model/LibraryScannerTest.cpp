@@ -0,0 +1,93 @@
+#include "LibraryScannerTest.h"
+#include "model/library/LibraryScanner.h"
+#include "model/library/MusicLibrary.h"
+#include <algorithm>
+#include <filesystem>
+
+std::string LibraryScannerTest::identify() const {
+    return "library_scanner_test";
+}
+
+void LibraryScannerTest::createFolder(const std::string& name) const {
+    std::filesystem::create_directories(test_directory_ + "/" + name);
+}
+
+std::vector<std::string> LibraryScannerTest::collect(const std::size_t batch, int* batches) const {
+    LibraryScanner scanner(test_directory_, MusicLibrary::isSupported, batch);
+    std::vector<std::string> result;
+    std::vector<std::string> found;
+    while (scanner.next(found)) {
+        result.insert(result.end(), found.begin(), found.end());
+        if (batches) (*batches)++;
+    }
+    std::ranges::sort(result);
+    return result;
+}
+
+TEST_F(LibraryScannerTest, FindsFilesInRoot) {
+    createFile("song.mp3");
+    EXPECT_EQ(std::vector<std::string>{test_directory_ + "/song.mp3"}, collect());
+}
+
+TEST_F(LibraryScannerTest, DescendsIntoNestedFolders) {
+    createFolder("Artist/Album");
+    createFile("Artist/Album/track.mp3");
+    createFile("Artist/single.wav");
+    const auto found = collect();
+    ASSERT_EQ(2, found.size());
+    EXPECT_EQ(test_directory_ + "/Artist/Album/track.mp3", found[0]);
+    EXPECT_EQ(test_directory_ + "/Artist/single.wav", found[1]);
+}
+
+TEST_F(LibraryScannerTest, SkipsUnsupportedFiles) {
+    createFolder("Artist");
+    createFile("Artist/cover.jpg");
+    createFile("notes.txt");
+    EXPECT_TRUE(collect().empty());
+}
+
+TEST_F(LibraryScannerTest, SkipsFolderNamedLikeSong) {
+    createFolder("folder.mp3");
+    EXPECT_TRUE(collect().empty());
+}
+
+TEST_F(LibraryScannerTest, StreamsResultsInBatches) {
+    for (int i = 0; i < 10; i++) {
+        createFile("song" + std::to_string(i) + ".mp3");
+    }
+    int batches = 0;
+    EXPECT_EQ(10, collect(3, &batches).size());
+    EXPECT_GE(batches, 4);
+}
+
+TEST_F(LibraryScannerTest, FindsEveryFileInWideTree) {
+    for (int artist = 0; artist < 20; artist++) {
+        for (int album = 0; album < 5; album++) {
+            const std::string folder = "a" + std::to_string(artist) + "/b" + std::to_string(album);
+            createFolder(folder);
+            createFile(folder + "/t1.mp3");
+            createFile(folder + "/t2.wav");
+        }
+    }
+    EXPECT_EQ(200, collect(16).size());
+}
+
+TEST_F(LibraryScannerTest, FollowsSymlinkedFiles) {
+    createFile("real.mp3");
+    std::filesystem::create_symlink(test_directory_ + "/real.mp3", test_directory_ + "/link.mp3");
+    EXPECT_EQ(2, collect().size());
+}
+
+TEST_F(LibraryScannerTest, MissingRootFindsNothing) {
+    LibraryScanner scanner(test_directory_ + "/missing", MusicLibrary::isSupported);
+    std::vector<std::string> found;
+    EXPECT_FALSE(scanner.next(found));
+}
+
+TEST_F(LibraryScannerTest, NewestTracksFolderStamps) {
+    createFolder("Artist");
+    LibraryScanner scanner(test_directory_, MusicLibrary::isSupported);
+    std::vector<std::string> found;
+    while (scanner.next(found)) {}
+    EXPECT_GT(scanner.newest(), 0);
+}
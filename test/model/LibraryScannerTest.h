@@ -0,0 +1,15 @@
+#ifndef LIBRARY_SCANNER_TEST_H
+#define LIBRARY_SCANNER_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include <string>
+#include <vector>
+
+class LibraryScannerTest : public DirectoryTestFixture {
+protected:
+    std::string identify() const override;
+    void createFolder(const std::string& name) const;
+    std::vector<std::string> collect(std::size_t batch = 256, int* batches = nullptr) const;
+};
+
+#endif //LIBRARY_SCANNER_TEST_H
@@ -0,0 +1,165 @@
+#include "MetadataCacheTest.h"
+#include <filesystem>
+#include <chrono>
+
+std::string MetadataCacheTest::identify() const {
+    return "metadata_cache_test";
+}
+
+TEST_F(MetadataCacheTest, SizeReadsDiskForUnknownPath) {
+    const std::string path = writeFile("song.mp3", std::string(42, 'x'));
+    EXPECT_EQ(42, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, SizeReturnsZeroForMissingFile) {
+    EXPECT_EQ(0, cache_.size(test_directory_ + "/missing.mp3"));
+}
+
+TEST_F(MetadataCacheTest, FillServesCachedSize) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    writeFile("song.mp3", std::string(20, 'x'));
+    EXPECT_EQ(10, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, FillCachesStamp) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    EXPECT_GT(cache_.stamp(path), 0);
+}
+
+TEST_F(MetadataCacheTest, RefreshPicksUpChanges) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    writeFile("song.mp3", std::string(20, 'x'));
+    EXPECT_TRUE(cache_.refresh(path));
+    EXPECT_EQ(20, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, RefreshReportsUnchangedEntry) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    EXPECT_FALSE(cache_.refresh(path));
+}
+
+TEST_F(MetadataCacheTest, RefreshDropsDeletedFile) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    std::filesystem::remove(path);
+    cache_.refresh(path);
+    EXPECT_EQ(0, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, ForgetFallsBackToDisk) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    writeFile("song.mp3", std::string(30, 'x'));
+    cache_.forget(path);
+    EXPECT_EQ(30, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, RestoreServesSavedEntries) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, test_directory_);
+
+    writeFile("song.mp3", std::string(50, 'x'));
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    EXPECT_EQ(10, restored.size(path));
+}
+
+TEST_F(MetadataCacheTest, RestoreKeepsPathsWithControlCharacters) {
+    const std::string odd = writeFile("odd\nname\twith\\slash.mp3", std::string(10, 'x'));
+    const std::string plain = writeFile("plain.mp3", std::string(20, 'x'));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({odd, plain});
+    cache_.save(catalog, test_directory_);
+
+    writeFile("odd\nname\twith\\slash.mp3", std::string(30, 'x'));
+    writeFile("plain.mp3", std::string(40, 'x'));
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    EXPECT_EQ(10, restored.size(odd));
+    EXPECT_EQ(20, restored.size(plain));
+}
+
+TEST_F(MetadataCacheTest, FillRevalidatesRestoredEntries) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, test_directory_);
+
+    writeFile("song.mp3", std::string(50, 'x'));
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    restored.fill({path});
+    EXPECT_EQ(50, restored.size(path));
+}
+
+TEST_F(MetadataCacheTest, FillDropsRestoredEntriesOfRemovedFiles) {
+    const std::string path = writeFile("song.wav", std::string("RIFF\0\0\0\0WAVELIST\x14\0\0\0INFOIART\x07\0\0\0Artist\0\0", 40));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, test_directory_);
+
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    std::filesystem::remove(path);
+    restored.fill({path});
+    EXPECT_TRUE(restored.tags(path).artist.empty());
+}
+
+TEST_F(MetadataCacheTest, RestoreIgnoresCatalogOlderThanDirectory) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, test_directory_);
+    std::filesystem::last_write_time(catalog,
+        std::filesystem::last_write_time(test_directory_) - std::chrono::seconds(10));
+
+    writeFile("song.mp3", std::string(50, 'x'));
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    EXPECT_EQ(50, restored.size(path));
+}
+
+TEST_F(MetadataCacheTest, RestoreDiscardsEntriesOfDirectory) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    cache_.fill({path});
+    writeFile("song.mp3", std::string(60, 'x'));
+    cache_.restore(test_directory_ + "/.missing", test_directory_);
+    EXPECT_EQ(60, cache_.size(path));
+}
+
+TEST_F(MetadataCacheTest, SaveSkipsOtherDirectories) {
+    const std::string path = writeFile("song.mp3", std::string(10, 'x'));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, "/elsewhere");
+
+    writeFile("song.mp3", std::string(70, 'x'));
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    EXPECT_EQ(70, restored.size(path));
+}
+
+TEST_F(MetadataCacheTest, FillCachesTags) {
+    const std::string path = writeFile("song.wav", std::string("RIFF\0\0\0\0WAVELIST\x14\0\0\0INFOIART\x07\0\0\0Artist\0\0", 40));
+    cache_.fill({path});
+    std::filesystem::remove(path);
+    EXPECT_EQ("Artist", cache_.tags(path).artist);
+}
+
+TEST_F(MetadataCacheTest, RestoreKeepsTags) {
+    const std::string path = writeFile("song.wav", std::string("RIFF\0\0\0\0WAVELIST\x14\0\0\0INFOIART\x07\0\0\0Artist\0\0", 40));
+    const std::string catalog = test_directory_ + "/.metadata";
+    cache_.fill({path});
+    cache_.save(catalog, test_directory_);
+
+    MetadataCache restored;
+    restored.restore(catalog, test_directory_);
+    std::filesystem::remove(path);
+    EXPECT_EQ("Artist", restored.tags(path).artist);
+}
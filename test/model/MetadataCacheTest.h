@@ -0,0 +1,14 @@
+#ifndef METADATA_CACHE_TEST_H
+#define METADATA_CACHE_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include "model/core/MetadataCache.h"
+
+class MetadataCacheTest : public DirectoryTestFixture {
+protected:
+    MetadataCache cache_;
+
+    std::string identify() const override;
+};
+
+#endif //METADATA_CACHE_TEST_H
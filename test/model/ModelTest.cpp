@@ -126,7 +126,7 @@ TEST_F(ModelTest, InsertDuplicateFile) {
     createSong("existing.mp3");
     std::string srcDir = base_directory_ + "/import";
     std::filesystem::create_directories(srcDir);
-    std::ofstream(srcDir + "/existing.mp3") << "audio";
+    std::ofstream(srcDir + "/existing.mp3") << "audio existing.mp3";
 
     MusicPlayer musicPlayer = create();
     musicPlayer.subscribe(listener_);
@@ -264,8 +264,8 @@ TEST_F(ModelTest, MultipleRemoves) {
 TEST_F(ModelTest, MultipleInserts) {
     std::string srcDir = base_directory_ + "/import";
     std::filesystem::create_directories(srcDir);
-    std::ofstream(srcDir + "/a.mp3") << "audio";
-    std::ofstream(srcDir + "/b.mp3") << "audio";
+    std::ofstream(srcDir + "/a.mp3") << "audio a.mp3";
+    std::ofstream(srcDir + "/b.mp3") << "audio b.mp3";
 
     MusicPlayer musicPlayer = create();
     musicPlayer.subscribe(listener_);
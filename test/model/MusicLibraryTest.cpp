@@ -1,6 +1,7 @@
 #include "MusicLibraryTest.h"
 #include "model/library/MusicLibrary.h"
 #include "../TestPlaylistVisitor.h"
+#include <filesystem>
 #include <fstream>
 
 std::string MusicLibraryTest::identify() const {
@@ -34,6 +35,26 @@ TEST_F(MusicLibraryTest, ScanMixedFiles) {
     EXPECT_EQ(2, result.size());
 }
 
+TEST_F(MusicLibraryTest, ScanFindsNestedFiles) {
+    std::filesystem::create_directories(test_directory_ + "/Artist/Album");
+    createFile("Artist/Album/song.mp3");
+    auto result = MusicLibrary::scan(test_directory_);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ(test_directory_ + "/Artist/Album/song.mp3", result[0]);
+}
+
+TEST_F(MusicLibraryTest, LoadNamesNestedSongByFilename) {
+    std::filesystem::create_directories(test_directory_ + "/Artist");
+    createFile("Artist/song.mp3");
+    MusicLibrary lib(test_directory_);
+    auto songs = lib.load();
+    ASSERT_EQ(1, songs.size());
+    TestPlaylistVisitor visitor;
+    songs[0].accept(visitor);
+    EXPECT_TRUE(visitor.hasName("song.mp3"));
+    EXPECT_TRUE(visitor.hasPath(test_directory_ + "/Artist/song.mp3"));
+}
+
 TEST_F(MusicLibraryTest, ScanEmptyDirectory) {
     auto result = MusicLibrary::scan(test_directory_);
     EXPECT_EQ(0, result.size());
@@ -131,12 +152,27 @@ TEST_F(MusicLibraryTest, ImportReturnsSong) {
     std::ofstream(srcDir + "/new.mp3") << "data";
 
     const MusicLibrary lib(test_directory_);
-    const Song song = lib.import(srcDir + "/new.mp3");
+    const std::optional<Song> song = lib.import(srcDir + "/new.mp3");
+    ASSERT_TRUE(song);
     TestPlaylistVisitor visitor;
-    song.accept(visitor);
+    song->accept(visitor);
     EXPECT_TRUE(visitor.hasName("new.mp3"));
 }
 
+TEST_F(MusicLibraryTest, ImportFailsWhenSourceVanishes) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    std::vector<std::string> reasons;
+    const std::vector<ImportQueue::Transfer> transfers = lib.admit({srcDir + "/new.mp3"}, reasons);
+    ASSERT_EQ(1, transfers.size());
+    std::filesystem::remove(srcDir + "/new.mp3");
+    EXPECT_FALSE(lib.import(transfers[0]));
+    EXPECT_FALSE(lib.contains("new.mp3"));
+}
+
 TEST_F(MusicLibraryTest, ImportDoesNotDuplicateExisting) {
     createFile("existing.mp3");
     const std::string srcDir = test_directory_ + "/src";
@@ -155,6 +191,99 @@ TEST_F(MusicLibraryTest, EraseRemovesFile) {
     EXPECT_FALSE(lib.contains("to_delete.mp3"));
 }
 
+TEST_F(MusicLibraryTest, ContainsFileIndexedByLoad) {
+    createFile("indexed.mp3");
+    const MusicLibrary lib(test_directory_);
+    lib.load();
+    EXPECT_TRUE(lib.contains("indexed.mp3"));
+    EXPECT_FALSE(lib.contains("missing.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ContainsIgnoresNestedFileAfterLoad) {
+    std::filesystem::create_directories(test_directory_ + "/Artist");
+    createFile("Artist/nested.mp3");
+    const MusicLibrary lib(test_directory_);
+    lib.load();
+    EXPECT_FALSE(lib.contains("nested.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ContainsDropsStaleEntry) {
+    createFile("stale.mp3");
+    const MusicLibrary lib(test_directory_);
+    lib.load();
+    std::filesystem::remove(test_directory_ + "/stale.mp3");
+    EXPECT_FALSE(lib.contains("stale.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ImportAfterLoadIsIndexed) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    lib.load();
+    lib.import(srcDir + "/new.mp3");
+    EXPECT_TRUE(lib.contains("new.mp3"));
+}
+
+TEST_F(MusicLibraryTest, EraseAfterLoadUpdatesIndex) {
+    createFile("to_delete.mp3");
+    MusicLibrary lib(test_directory_);
+    lib.load();
+    lib.erase(test_directory_ + "/to_delete.mp3");
+    EXPECT_FALSE(lib.contains("to_delete.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ValidateRejectsSameContentUnderNewName) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/song.mp3") << "data";
+    std::ofstream(srcDir + "/song copy.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/song.mp3");
+    EXPECT_EQ("This song already exists.", lib.validate(srcDir + "/song copy.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ImportRenamesDifferentContentWithSameName) {
+    createFile("song.mp3");
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/song.mp3") << "different data";
+
+    const MusicLibrary lib(test_directory_);
+    const std::optional<Song> song = lib.import(srcDir + "/song.mp3");
+    ASSERT_TRUE(song);
+    TestPlaylistVisitor visitor;
+    song->accept(visitor);
+    EXPECT_TRUE(visitor.hasName("song (1).mp3"));
+    EXPECT_TRUE(lib.contains("song (1).mp3"));
+}
+
+TEST_F(MusicLibraryTest, ImportLinksDisplayNameToStoredContent) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/new.mp3");
+    const std::filesystem::directory_iterator objects(test_directory_ + "/.objects");
+    ASSERT_NE(std::filesystem::directory_iterator(), objects);
+    EXPECT_TRUE(std::filesystem::equivalent(objects->path(), test_directory_ + "/new.mp3"));
+}
+
+TEST_F(MusicLibraryTest, EraseReleasesStoredContent) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/new.mp3");
+    lib.erase(test_directory_ + "/new.mp3");
+    EXPECT_TRUE(lib.validate(srcDir + "/new.mp3").empty());
+    EXPECT_TRUE(std::filesystem::is_empty(test_directory_ + "/.objects"));
+}
+
 TEST_F(MusicLibraryTest, ScanReturnsFullPaths) {
     createFile("song.mp3");
     auto result = MusicLibrary::scan(test_directory_);
@@ -169,4 +298,59 @@ TEST_F(MusicLibraryTest, LoadSongsAcceptVisitor) {
     TestPlaylistVisitor visitor;
     songs[0].accept(visitor);
     EXPECT_TRUE(visitor.hasName("test.mp3"));
-}
\ No newline at end of file
+}
+
+TEST_F(MusicLibraryTest, ValidateAcceptsSongWhoseDisplayLinkWasDeleted) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/new.mp3");
+    std::filesystem::remove(test_directory_ + "/new.mp3");
+    EXPECT_TRUE(lib.validate(srcDir + "/new.mp3").empty());
+    EXPECT_EQ(1, std::filesystem::hard_link_count(srcDir + "/new.mp3"));
+}
+
+TEST_F(MusicLibraryTest, ValidateKeepsOrphanedObject) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/new.mp3") << "data";
+
+    const MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/new.mp3");
+    std::filesystem::remove(test_directory_ + "/new.mp3");
+    lib.validate(srcDir + "/new.mp3");
+    EXPECT_FALSE(std::filesystem::is_empty(test_directory_ + "/.objects"));
+}
+
+TEST_F(MusicLibraryTest, PruneRemovesOrphanedObjects) {
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/kept.mp3") << "kept";
+    std::ofstream(srcDir + "/dropped.mp3") << "dropped";
+
+    MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/kept.mp3");
+    lib.import(srcDir + "/dropped.mp3");
+    std::filesystem::remove(test_directory_ + "/dropped.mp3");
+    lib.prune();
+    const std::filesystem::directory_iterator objects(test_directory_ + "/.objects");
+    ASSERT_NE(std::filesystem::directory_iterator(), objects);
+    EXPECT_TRUE(std::filesystem::equivalent(objects->path(), test_directory_ + "/kept.mp3"));
+    EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator(test_directory_ + "/.objects"),
+                               std::filesystem::directory_iterator()));
+}
+
+TEST_F(MusicLibraryTest, EraseReleasesRenamedStoredContent) {
+    createFile("song.mp3");
+    const std::string srcDir = test_directory_ + "/src";
+    std::filesystem::create_directories(srcDir);
+    std::ofstream(srcDir + "/song.mp3") << "different data";
+
+    MusicLibrary lib(test_directory_);
+    lib.import(srcDir + "/song.mp3");
+    lib.erase(test_directory_ + "/song (1).mp3");
+    EXPECT_TRUE(std::filesystem::is_empty(test_directory_ + "/.objects"));
+    EXPECT_TRUE(lib.contains("song.mp3"));
+}
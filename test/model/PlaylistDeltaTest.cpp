@@ -0,0 +1,74 @@
+#include "PlaylistDeltaTest.h"
+
+TEST_F(PlaylistDeltaTest, StartsEmpty) {
+    EXPECT_TRUE(delta_.isEmpty());
+}
+
+TEST_F(PlaylistDeltaTest, RecordsSingleInsert) {
+    delta_.insert(3);
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Inserted, delta_.steps()[0].kind);
+    EXPECT_EQ(3, delta_.steps()[0].first);
+    EXPECT_EQ(1, delta_.steps()[0].count);
+}
+
+TEST_F(PlaylistDeltaTest, CoalescesAdjacentInserts) {
+    delta_.insert(3);
+    delta_.insert(4);
+    delta_.insert(3);
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ(3, delta_.steps()[0].first);
+    EXPECT_EQ(3, delta_.steps()[0].count);
+}
+
+TEST_F(PlaylistDeltaTest, KeepsDistantInsertsApart) {
+    delta_.insert(3);
+    delta_.insert(7);
+    EXPECT_EQ(2, delta_.steps().size());
+}
+
+TEST_F(PlaylistDeltaTest, CoalescesRemovesAtSamePosition) {
+    delta_.remove(2);
+    delta_.remove(2);
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ(2, delta_.steps()[0].first);
+    EXPECT_EQ(2, delta_.steps()[0].count);
+}
+
+TEST_F(PlaylistDeltaTest, CoalescesRemovesWalkingBackwards) {
+    delta_.remove(5);
+    delta_.remove(4);
+    delta_.remove(3);
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Removed, delta_.steps()[0].kind);
+    EXPECT_EQ(3, delta_.steps()[0].first);
+    EXPECT_EQ(3, delta_.steps()[0].count);
+}
+
+TEST_F(PlaylistDeltaTest, RemovesRange) {
+    delta_.remove(0, 4);
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ(4, delta_.steps()[0].count);
+}
+
+TEST_F(PlaylistDeltaTest, IgnoresEmptyRemove) {
+    delta_.remove(0, 0);
+    EXPECT_TRUE(delta_.isEmpty());
+}
+
+TEST_F(PlaylistDeltaTest, ComposesConsecutiveMoves) {
+    delta_.move({2, 0, 1});
+    delta_.move({2, 1, 0});
+    ASSERT_EQ(1, delta_.steps().size());
+    EXPECT_EQ((std::vector<std::size_t>{1, 0, 2}), delta_.steps()[0].order);
+}
+
+TEST_F(PlaylistDeltaTest, KeepsStepsInOrder) {
+    delta_.insert(0);
+    delta_.move({1, 0});
+    delta_.remove(1);
+    ASSERT_EQ(3, delta_.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Inserted, delta_.steps()[0].kind);
+    EXPECT_EQ(PlaylistDelta::Kind::Moved, delta_.steps()[1].kind);
+    EXPECT_EQ(PlaylistDelta::Kind::Removed, delta_.steps()[2].kind);
+}
@@ -0,0 +1,12 @@
+#ifndef PLAYLIST_DELTA_TEST_H
+#define PLAYLIST_DELTA_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/events/PlaylistDelta.h"
+
+class PlaylistDeltaTest : public ::testing::Test {
+protected:
+    PlaylistDelta delta_;
+};
+
+#endif //PLAYLIST_DELTA_TEST_H
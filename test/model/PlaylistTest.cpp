@@ -1,6 +1,7 @@
 #include "PlaylistTest.h"
 #include "model/arrangement/DurationSort.h"
 #include "model/arrangement/QuickSort.h"
+#include "SortingTest.h"
 #include "model/events/IPlaybackListener.h"
 #include <filesystem>
 #include <fstream>
@@ -242,6 +243,183 @@ TEST_F(PlaylistTest, SearchEmptyQueryReturnsAll) {
     EXPECT_TRUE(visitor_.hasSongs(3));
 }
 
+TEST_F(PlaylistTest, SearchShortQueryScansAll) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    playlist_->search("lo", visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(1));
+}
+
+TEST_F(PlaylistTest, SearchKeepsPlaylistOrder) {
+    playlist_->add(Song("Hello B.mp3", "/b"));
+    playlist_->add(Song("Goodbye.mp3", "/g"));
+    playlist_->add(Song("Hello A.mp3", "/a"));
+    playlist_->search("Hello", visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Hello B.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "Hello A.mp3"));
+}
+
+TEST_F(PlaylistTest, SearchSkipsRemovedSongs) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    playlist_->add(Song("Hello World.mp3", "/c"));
+    playlist_->remove(0);
+    playlist_->search("Hello", visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(1));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Hello World.mp3"));
+}
+
+TEST_F(PlaylistTest, SearchFollowsSortedOrder) {
+    playlist_->add(Song("Hello B.mp3", "/b"));
+    playlist_->add(Song("Hello A.mp3", "/a"));
+    QuickSort sort;
+    playlist_->sort(sort);
+    playlist_->search("Hello", visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Hello A.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "Hello B.mp3"));
+}
+
+TEST_F(PlaylistTest, SearchFindsNothingAfterClear) {
+    populate(3);
+    playlist_->clear();
+    playlist_->search("Song", visitor_);
+    EXPECT_TRUE(visitor_.isEmpty());
+}
+
+TEST_F(PlaylistTest, SearchFindsDuplicateAfterFirstRemoved) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->remove(0);
+    playlist_->pick("Hello", listener_);
+    EXPECT_TRUE(listener_.wasSelectedWith(1));
+}
+
+TEST_F(PlaylistTest, SearchReturnsEveryCopyOfDuplicate) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    playlist_->add(Song("Hello.mp3", "/a"));
+    EXPECT_EQ(2, playlist_->find("Hello").size());
+    EXPECT_EQ(2, playlist_->find("He").size());
+}
+
+TEST_F(PlaylistTest, SearchReturnsEveryCopyAfterSort) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    playlist_->add(Song("Hello.mp3", "/a"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->search("Hello", visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(3));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Hello.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "Hello.mp3"));
+}
+
+TEST_F(PlaylistTest, SongsExposesPlaylistOrder) {
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("A.mp3", "/a"));
+    const std::span<const Song> songs = playlist_->songs();
+    ASSERT_EQ(2, songs.size());
+    EXPECT_EQ("B.mp3", songs[0].name());
+    EXPECT_EQ("/a", songs[1].path());
+}
+
+TEST_F(PlaylistTest, SongsFollowsSortedOrder) {
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("A.mp3", "/a"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    EXPECT_EQ("A.mp3", playlist_->songs().front().name());
+}
+
+TEST_F(PlaylistTest, SongsIsEmptyAfterClear) {
+    populate(3);
+    playlist_->clear();
+    EXPECT_TRUE(playlist_->songs().empty());
+}
+
+TEST_F(PlaylistTest, FindReturnsMatchesInPlaylistOrder) {
+    playlist_->add(Song("Hello B.mp3", "/b"));
+    playlist_->add(Song("Goodbye.mp3", "/g"));
+    playlist_->add(Song("Hello A.mp3", "/a"));
+    const std::vector<Song> found = playlist_->find("Hello");
+    ASSERT_EQ(2, found.size());
+    EXPECT_EQ("Hello B.mp3", found[0].name());
+    EXPECT_EQ("Hello A.mp3", found[1].name());
+}
+
+TEST_F(PlaylistTest, FindShortQueryScansAll) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->add(Song("Goodbye.mp3", "/b"));
+    const std::vector<Song> found = playlist_->find("lo");
+    ASSERT_EQ(1, found.size());
+    EXPECT_EQ("Hello.mp3", found[0].name());
+}
+
+TEST_F(PlaylistTest, ReverseFollowsSelectedSong) {
+    populate(4);
+    playlist_->select(1, listener_);
+    playlist_->reverse();
+    playlist_->play(visitor_);
+    EXPECT_TRUE(visitor_.hasName("(2) Song1.mp3"));
+    EXPECT_TRUE(playlist_->hasNext());
+}
+
+TEST_F(PlaylistTest, PickSelectsFirstIndexedMatch) {
+    playlist_->add(Song("Goodbye.mp3", "/g"));
+    playlist_->add(Song("Hello.mp3", "/h"));
+    playlist_->pick("Hello", listener_);
+    EXPECT_TRUE(listener_.wasSelectedWith(1));
+}
+
+TEST_F(PlaylistTest, MergeSkipsSongsAlreadyPresent) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->merge({Song("A.mp3", "/a"), Song("B.mp3", "/b")});
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(2));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "B.mp3"));
+}
+
+TEST_F(PlaylistTest, PruneKeepsFilesOnDisk) {
+    std::ofstream(test_directory_ + "/a.mp3") << "audio";
+    playlist_->add(Song("a.mp3", test_directory_ + "/a.mp3"));
+    playlist_->prune([](const Song&) { return true; });
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.isEmpty());
+    EXPECT_TRUE(std::filesystem::exists(test_directory_ + "/a.mp3"));
+}
+
+TEST_F(PlaylistTest, PruneFollowsSelectedSong) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->select(2, listener_);
+    playlist_->prune([](const Song& song) { return song.isWithin("/a"); });
+    playlist_->play(visitor_);
+    EXPECT_TRUE(visitor_.hasName("C.mp3"));
+    EXPECT_FALSE(playlist_->hasNext());
+}
+
+TEST_F(PlaylistTest, PruneDropsSearchEntries) {
+    playlist_->add(Song("Hello.mp3", "/a"));
+    playlist_->prune([](const Song&) { return true; });
+    playlist_->search("Hello", visitor_);
+    EXPECT_TRUE(visitor_.isEmpty());
+}
+
+TEST_F(PlaylistTest, RemovedFolderWithTrailingSlashLeavesPlaylist) {
+    playlist_->add(Song("a.mp3", "/music/Album/a.mp3"));
+    playlist_->add(Song("b.mp3", "/music/Other/b.mp3"));
+    playlist_->add(Song("c.mp3", "/music/Album/c.mp3"));
+    LibraryChange change;
+    change.remove("/music/Album/");
+    EXPECT_TRUE(change.apply(*playlist_));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(1));
+    EXPECT_TRUE(visitor_.hasName("b.mp3"));
+}
+
 TEST_F(PlaylistTest, HasNextWhenMoreSongsExist) {
     populate(3);
     playlist_->select(0, listener_);
@@ -372,6 +550,34 @@ TEST_F(PlaylistTest, RestorePreservesCurrentSong) {
     EXPECT_TRUE(listener_.wasSelectedWith(1));
 }
 
+TEST_F(PlaylistTest, RestoreKeepsSongsAddedAfterSort) {
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("A.mp3", "/a"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->restore();
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(3));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "C.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "A.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "B.mp3"));
+}
+
+TEST_F(PlaylistTest, RestoreDropsSongsRemovedAfterSort) {
+    playlist_->add(Song("C.mp3", test_directory_ + "/c.mp3"));
+    playlist_->add(Song("A.mp3", test_directory_ + "/a.mp3"));
+    playlist_->add(Song("B.mp3", test_directory_ + "/b.mp3"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->remove(0);
+    playlist_->restore();
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(2));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "C.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "B.mp3"));
+}
+
 TEST_F(PlaylistTest, SortReverseRestoreFullCycle) {
     playlist_->add(Song("C.mp3", "/c"));
     playlist_->add(Song("A.mp3", "/a"));
@@ -384,4 +590,294 @@ TEST_F(PlaylistTest, SortReverseRestoreFullCycle) {
     EXPECT_TRUE(visitor_.hasNameAt(0, "C.mp3"));
     EXPECT_TRUE(visitor_.hasNameAt(1, "A.mp3"));
     EXPECT_TRUE(visitor_.hasNameAt(2, "B.mp3"));
-}
\ No newline at end of file
+}
+TEST_F(PlaylistTest, AddKeepsActiveSortOrder) {
+    playlist_->add(Song("D.mp3", "/d"));
+    playlist_->add(Song("B.mp3", "/b"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("E.mp3", "/e"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "A.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "B.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "C.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(3, "D.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(4, "E.mp3"));
+}
+
+TEST_F(PlaylistTest, AddKeepsReversedSortOrder) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("C.mp3", "/c"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->reverse();
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("D.mp3", "/d"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "D.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "C.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "B.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(3, "A.mp3"));
+}
+
+TEST_F(PlaylistTest, AddAfterRemoveKeepsSortOrder) {
+    playlist_->add(Song("C.mp3", test_directory_ + "/c.mp3"));
+    playlist_->add(Song("A.mp3", test_directory_ + "/a.mp3"));
+    playlist_->add(Song("E.mp3", test_directory_ + "/e.mp3"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->remove(1);
+    playlist_->add(Song("D.mp3", "/d"));
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(4));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "A.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "B.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "D.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(3, "E.mp3"));
+}
+
+TEST_F(PlaylistTest, AddAfterPruneKeepsSortOrder) {
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("E.mp3", "/e"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->prune([](const Song& song) { return song.matches("C"); });
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasSongs(3));
+    EXPECT_TRUE(visitor_.hasNameAt(0, "A.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "B.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "E.mp3"));
+}
+
+TEST_F(PlaylistTest, AddBeforeCurrentSongKeepsSelection) {
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("C.mp3", "/c"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->select(1, listener_);
+    playlist_->add(Song("A.mp3", "/a"));
+    TestPlaylistVisitor player;
+    playlist_->play(player);
+    EXPECT_TRUE(player.hasName("C.mp3"));
+}
+
+TEST_F(PlaylistTest, AddAfterShuffleAppends) {
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("C.mp3", "/c"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->shuffle();
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(2, "A.mp3"));
+}
+
+TEST_F(PlaylistTest, AddAfterRestoreAppends) {
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("B.mp3", "/b"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->restore();
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(2, "A.mp3"));
+}
+
+TEST_F(PlaylistTest, SearchFindsSongInsertedInSortOrder) {
+    playlist_->add(Song("Gamma.mp3", "/g"));
+    playlist_->add(Song("Alpha.mp3", "/a"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->add(Song("Beta.mp3", "/b"));
+    playlist_->pick("Gamma", listener_);
+    EXPECT_TRUE(listener_.wasSelectedWith(2));
+}
+
+TEST_F(PlaylistTest, MergeIntoSortedPlaylistKeepsSearchPositions) {
+    playlist_->add(Song("Delta.mp3", "/d"));
+    playlist_->add(Song("Bravo.mp3", "/b"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->merge({Song("Echo.mp3", "/e"), Song("Alpha.mp3", "/a"), Song("Charlie.mp3", "/c")});
+    playlist_->pick("Delta", listener_);
+    playlist_->pick("Charlie", listener_);
+    EXPECT_TRUE(listener_.wasSelectedWith(3));
+    EXPECT_TRUE(listener_.wasSelectedWith(2));
+}
+
+TEST_F(PlaylistTest, ReturningToUnchangedModeReusesOrder) {
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(Song("a.mp3", "/a"));
+    playlist_->add(Song("bb.mp3", "/b"));
+    CountingSort byLength;
+    QuickSort byName;
+    playlist_->sort(byLength);
+    playlist_->sort(byName);
+    playlist_->sort(byLength);
+    EXPECT_EQ(3, byLength.extractions());
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "ccc.mp3"));
+}
+
+TEST_F(PlaylistTest, ReturningToModeAfterAddSortsAgain) {
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(Song("a.mp3", "/a"));
+    CountingSort byLength;
+    QuickSort byName;
+    playlist_->sort(byLength);
+    playlist_->sort(byName);
+    playlist_->add(Song("bb.mp3", "/b"));
+    playlist_->sort(byLength);
+    EXPECT_EQ(5, byLength.extractions());
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "ccc.mp3"));
+}
+
+TEST_F(PlaylistTest, AddInActiveModeKeepsCacheCurrent) {
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(Song("a.mp3", "/a"));
+    CountingSort byLength;
+    QuickSort byName;
+    playlist_->sort(byLength);
+    playlist_->add(Song("bb.mp3", "/b"));
+    playlist_->sort(byName);
+    playlist_->sort(byLength);
+    EXPECT_EQ(3, byLength.extractions());
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+}
+
+TEST_F(PlaylistTest, RevisedSongInvalidatesCachedOrder) {
+    const Song a("a.mp3", "/a");
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(a);
+    CountingSort byLength;
+    QuickSort byName;
+    playlist_->sort(byLength);
+    EXPECT_EQ(1, playlist_->revise({a}));
+    playlist_->add(Song("bb.mp3", "/b"));
+    playlist_->sort(byName);
+    playlist_->sort(byLength);
+    EXPECT_EQ(6, byLength.extractions());
+}
+
+TEST_F(PlaylistTest, RevisingUnknownSongKeepsCachedOrder) {
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(Song("a.mp3", "/a"));
+    CountingSort byLength;
+    QuickSort byName;
+    playlist_->sort(byLength);
+    EXPECT_EQ(0, playlist_->revise({Song("other.mp3", "/o")}));
+    playlist_->sort(byName);
+    playlist_->sort(byLength);
+    EXPECT_EQ(2, byLength.extractions());
+}
+
+TEST_F(PlaylistTest, DescendingSortReusesAscendingOrder) {
+    playlist_->add(Song("a.mp3", "/a"));
+    playlist_->add(Song("ccc.mp3", "/c"));
+    playlist_->add(Song("bb.mp3", "/b"));
+    CountingSort byLength;
+    playlist_->sort(byLength);
+    playlist_->sort(byLength, true);
+    EXPECT_EQ(3, byLength.extractions());
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "ccc.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "a.mp3"));
+}
+
+TEST_F(PlaylistTest, AddKeepsDescendingSortOrder) {
+    playlist_->add(Song("a.mp3", "/a"));
+    playlist_->add(Song("ccc.mp3", "/c"));
+    CountingSort byLength;
+    playlist_->sort(byLength, true);
+    playlist_->add(Song("bb.mp3", "/b"));
+    playlist_->accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "ccc.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "a.mp3"));
+}
+
+TEST_F(PlaylistTest, DrainReportsInsertedSongs) {
+    populate(3);
+    const PlaylistDelta delta = playlist_->drain();
+    ASSERT_EQ(1, delta.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Inserted, delta.steps()[0].kind);
+    EXPECT_EQ(0, delta.steps()[0].first);
+    EXPECT_EQ(3, delta.steps()[0].count);
+}
+
+TEST_F(PlaylistTest, DrainResetsDelta) {
+    populate(3);
+    playlist_->drain();
+    EXPECT_TRUE(playlist_->drain().isEmpty());
+}
+
+TEST_F(PlaylistTest, DrainReportsSortedInsertPosition) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("C.mp3", "/c"));
+    QuickSort byName;
+    playlist_->sort(byName);
+    playlist_->drain();
+    playlist_->add(Song("B.mp3", "/b"));
+    const PlaylistDelta delta = playlist_->drain();
+    ASSERT_EQ(1, delta.steps().size());
+    EXPECT_EQ(1, delta.steps()[0].first);
+}
+
+TEST_F(PlaylistTest, DrainReportsSortPermutation) {
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->drain();
+    QuickSort byName;
+    playlist_->sort(byName);
+    const PlaylistDelta delta = playlist_->drain();
+    ASSERT_EQ(1, delta.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Moved, delta.steps()[0].kind);
+    EXPECT_EQ((std::vector<std::size_t>{1, 2, 0}), delta.steps()[0].order);
+}
+
+TEST_F(PlaylistTest, DrainTracksDuplicateSongsThroughReverse) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->drain();
+    playlist_->reverse();
+    const PlaylistDelta delta = playlist_->drain();
+    EXPECT_EQ((std::vector<std::size_t>{0, 1, 2}), delta.steps()[0].order);
+}
+
+TEST_F(PlaylistTest, DrainCoalescesPrunedNeighbours) {
+    playlist_->add(Song("A.mp3", "/a"));
+    playlist_->add(Song("B.mp3", "/b"));
+    playlist_->add(Song("C.mp3", "/c"));
+    playlist_->add(Song("D.mp3", "/d"));
+    playlist_->drain();
+    playlist_->prune([](const Song& song) { return song.matches("B") || song.matches("C"); });
+    const PlaylistDelta delta = playlist_->drain();
+    ASSERT_EQ(1, delta.steps().size());
+    EXPECT_EQ(PlaylistDelta::Kind::Removed, delta.steps()[0].kind);
+    EXPECT_EQ(1, delta.steps()[0].first);
+    EXPECT_EQ(2, delta.steps()[0].count);
+}
+
+TEST_F(PlaylistTest, DrainReportsClearAsRemoval) {
+    populate(4);
+    playlist_->drain();
+    playlist_->clear();
+    const PlaylistDelta delta = playlist_->drain();
+    ASSERT_EQ(1, delta.steps().size());
+    EXPECT_EQ(0, delta.steps()[0].first);
+    EXPECT_EQ(4, delta.steps()[0].count);
+}
@@ -0,0 +1,45 @@
+#include "SearchIndexTest.h"
+
+using Keys = std::vector<std::uint64_t>;
+
+TEST_F(SearchIndexTest, CoversQueriesOfThreeCharacters) {
+    EXPECT_FALSE(index_.covers("ab"));
+    EXPECT_TRUE(index_.covers("abc"));
+}
+
+TEST_F(SearchIndexTest, CandidatesShareEveryTrigram) {
+    index_.add(0, "Hello.mp3");
+    index_.add(1, "Goodbye.mp3");
+    index_.add(2, "Hello World.mp3");
+    EXPECT_EQ(index_.candidates("Hello"), (Keys{0, 2}));
+}
+
+TEST_F(SearchIndexTest, CandidatesAreSortedByKey) {
+    index_.add(5, "Song");
+    index_.add(1, "Song");
+    index_.add(3, "Song");
+    EXPECT_EQ(index_.candidates("Song"), (Keys{1, 3, 5}));
+}
+
+TEST_F(SearchIndexTest, UnknownTrigramHasNoCandidates) {
+    index_.add(0, "Hello.mp3");
+    EXPECT_TRUE(index_.candidates("ZZZ").empty());
+}
+
+TEST_F(SearchIndexTest, CandidatesMayNeedVerification) {
+    index_.add(0, "abcXbcd");
+    EXPECT_EQ(index_.candidates("abcd"), (Keys{0}));
+}
+
+TEST_F(SearchIndexTest, RemoveDropsKey) {
+    index_.add(0, "Hello");
+    index_.add(1, "Hello");
+    index_.remove(0, "Hello");
+    EXPECT_EQ(index_.candidates("Hello"), (Keys{1}));
+}
+
+TEST_F(SearchIndexTest, ClearForgetsEverything) {
+    index_.add(0, "Hello");
+    index_.clear();
+    EXPECT_TRUE(index_.candidates("Hello").empty());
+}
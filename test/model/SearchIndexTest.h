@@ -0,0 +1,12 @@
+#ifndef SEARCH_INDEX_TEST_H
+#define SEARCH_INDEX_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/core/SearchIndex.h"
+
+class SearchIndexTest : public ::testing::Test {
+protected:
+    SearchIndex index_;
+};
+
+#endif //SEARCH_INDEX_TEST_H
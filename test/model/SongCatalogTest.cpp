@@ -0,0 +1,119 @@
+#include "SongCatalogTest.h"
+#include <thread>
+#include <vector>
+
+TEST_F(SongCatalogTest, InternReturnsSameIdForSameSong) {
+    const auto first = catalog_.intern("song.mp3", "/music/song.mp3");
+    const auto second = catalog_.intern("song.mp3", "/music/song.mp3");
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, catalog_.size());
+}
+
+TEST_F(SongCatalogTest, InternSeparatesDirectories) {
+    const auto first = catalog_.intern("song.mp3", "/music/song.mp3");
+    const auto second = catalog_.intern("song.mp3", "/other/song.mp3");
+    EXPECT_NE(first, second);
+}
+
+TEST_F(SongCatalogTest, InternSeparatesNamesOnSamePath) {
+    const auto first = catalog_.intern("a.mp3", "/s");
+    const auto second = catalog_.intern("b.mp3", "/s");
+    EXPECT_NE(first, second);
+}
+
+TEST_F(SongCatalogTest, NameReturnsInternedName) {
+    const auto id = catalog_.intern("(1) First Song.mp3", "/music/(1) First Song.mp3");
+    EXPECT_EQ("(1) First Song.mp3", catalog_.name(id));
+}
+
+TEST_F(SongCatalogTest, CollationIsBuiltFromTitle) {
+    const auto id = catalog_.intern("(3) Track 10.mp3", "/music/(3) Track 10.mp3");
+    EXPECT_EQ(Collation::key("Track 10.mp3"), catalog_.collation(id));
+}
+
+TEST_F(SongCatalogTest, CollationSharesPlainName) {
+    const auto id = catalog_.intern("song.wav", "/music/song.wav");
+    EXPECT_EQ("song.wav", catalog_.collation(id));
+}
+
+TEST_F(SongCatalogTest, PathJoinsDirectoryAndLeaf) {
+    const auto id = catalog_.intern("song.mp3", "/music/song.mp3");
+    EXPECT_EQ("/music/song.mp3", catalog_.path(id));
+}
+
+TEST_F(SongCatalogTest, PathKeepsLeafDifferentFromName) {
+    const auto id = catalog_.intern("Title.mp3", "/music/file.mp3");
+    EXPECT_EQ("Title.mp3", catalog_.name(id));
+    EXPECT_EQ("/music/file.mp3", catalog_.path(id));
+}
+
+TEST_F(SongCatalogTest, PathWithoutDirectory) {
+    const auto id = catalog_.intern("song.mp3", "song.mp3");
+    EXPECT_EQ("song.mp3", catalog_.path(id));
+}
+
+TEST_F(SongCatalogTest, NamesSurviveArenaGrowth) {
+    const auto first = catalog_.intern("first.mp3", "/music/first.mp3");
+    for (int i = 0; i < 1000; i++) {
+        const std::string name = "song" + std::to_string(i) + ".mp3";
+        catalog_.intern(name, "/music/" + name);
+    }
+    EXPECT_EQ("first.mp3", catalog_.name(first));
+    EXPECT_EQ(1001, catalog_.size());
+}
+
+TEST_F(SongCatalogTest, SharesDirectoryPrefix) {
+    SongCatalog shallow;
+    const std::string directory = "/music" + std::string(200, 'd') + "/";
+    const int songs = 1000;
+    ASSERT_GT(songs * directory.size(), 64 * 1024);
+    for (int i = 0; i < songs; i++) {
+        const std::string name = "song" + std::to_string(i) + ".mp3";
+        catalog_.intern(name, directory + name);
+        shallow.intern(name, "/" + name);
+    }
+    EXPECT_EQ(shallow.footprint(), catalog_.footprint());
+}
+
+TEST_F(SongCatalogTest, IsWithinMatchesExactPath) {
+    const auto id = catalog_.intern("song.mp3", "/music/Album/song.mp3");
+    EXPECT_TRUE(catalog_.isWithin(id, "/music/Album/song.mp3"));
+}
+
+TEST_F(SongCatalogTest, IsWithinMatchesParentFolders) {
+    const auto id = catalog_.intern("song.mp3", "/music/Album/song.mp3");
+    EXPECT_TRUE(catalog_.isWithin(id, "/music/Album"));
+    EXPECT_TRUE(catalog_.isWithin(id, "/music"));
+}
+
+TEST_F(SongCatalogTest, IsWithinAcceptsTrailingSlash) {
+    const auto id = catalog_.intern("song.mp3", "/music/Album/song.mp3");
+    EXPECT_TRUE(catalog_.isWithin(id, "/music/Album/"));
+    EXPECT_TRUE(catalog_.isWithin(id, "/music//"));
+    EXPECT_FALSE(catalog_.isWithin(id, "/music/Alb/"));
+}
+
+TEST_F(SongCatalogTest, IsWithinRejectsSiblingPrefix) {
+    const auto id = catalog_.intern("song.mp3", "/music/Album/song.mp3");
+    EXPECT_FALSE(catalog_.isWithin(id, "/music/Alb"));
+    EXPECT_FALSE(catalog_.isWithin(id, "/music/Album/song"));
+    EXPECT_FALSE(catalog_.isWithin(id, "/music/Album/song.mp3.bak"));
+}
+
+TEST_F(SongCatalogTest, InternIsSafeAcrossThreads) {
+    const auto first = catalog_.intern("first.mp3", "/music/first.mp3");
+    const std::string_view name = catalog_.name(first);
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([this, t] {
+                for (int i = 0; i < 500; i++) {
+                    const std::string song = "song" + std::to_string(t) + "_" + std::to_string(i) + ".mp3";
+                    catalog_.intern(song, "/music/" + song);
+                }
+            });
+        }
+    }
+    EXPECT_EQ("first.mp3", name);
+    EXPECT_EQ(2001, catalog_.size());
+}
@@ -0,0 +1,13 @@
+#ifndef SONG_CATALOG_TEST_H
+#define SONG_CATALOG_TEST_H
+
+#include <gtest/gtest.h>
+#include "model/core/SongCatalog.h"
+#include "model/core/Collation.h"
+
+class SongCatalogTest : public ::testing::Test {
+protected:
+    SongCatalog catalog_;
+};
+
+#endif //SONG_CATALOG_TEST_H
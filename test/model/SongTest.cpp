@@ -15,6 +15,16 @@ TEST_F(SongTest, AcceptPassesPathToVisitor) {
     EXPECT_TRUE(visitor_.hasPath("/music/song.mp3"));
 }
 
+TEST_F(SongTest, NameViewsInternedName) {
+    Song song("(1) First Song.mp3", "/music/(1) First Song.mp3");
+    EXPECT_EQ("(1) First Song.mp3", song.name());
+}
+
+TEST_F(SongTest, PathJoinsInternedPath) {
+    Song song("song.mp3", "/music/song.mp3");
+    EXPECT_EQ("/music/song.mp3", song.path());
+}
+
 TEST_F(SongTest, MatchFindsSubstring) {
     Song song("Beautiful Now.mp3", "/music/Beautiful Now.mp3");
     EXPECT_TRUE(song.matches("Beautiful"));
@@ -103,3 +113,52 @@ TEST_F(SongTest, ParseHandlesEmptyString) {
     EXPECT_EQ("", Song::parse(""));
 }
 
+TEST_F(SongTest, ParseAcceptsAnyWhitespaceAfterNumber) {
+    EXPECT_EQ("Song.mp3", Song::parse("(7)\tSong.mp3"));
+}
+
+TEST_F(SongTest, ParseKeepsNumberWithoutSeparator) {
+    EXPECT_EQ("(7)Song.mp3", Song::parse("(7)Song.mp3"));
+}
+
+TEST_F(SongTest, ParseKeepsNonNumericPrefix) {
+    EXPECT_EQ("(Live) Song.mp3", Song::parse("(Live) Song.mp3"));
+    EXPECT_EQ("() Song.mp3", Song::parse("() Song.mp3"));
+}
+
+TEST_F(SongTest, ParseKeepsNumberWithoutTitle) {
+    EXPECT_EQ("(7)", Song::parse("(7) "));
+}
+
+TEST_F(SongTest, ParseReturnsEmptyForBlankTitle) {
+    EXPECT_EQ("", Song::parse("(7)  "));
+}
+
+TEST_F(SongTest, ParseKeepsMultilineName) {
+    EXPECT_EQ("(7) A\nB", Song::parse("(7) A\nB"));
+}
+
+TEST_F(SongTest, ParseReturnsViewIntoName) {
+    const std::string name = "(1) First Song.mp3";
+    const std::string_view title = Song::parse(name);
+    EXPECT_EQ(name.data() + 4, title.data());
+}
+
+
+TEST_F(SongTest, SameNameAndPathShareId) {
+    const Song first("song.mp3", "/music/song.mp3");
+    const Song second("song.mp3", "/music/song.mp3");
+    EXPECT_EQ(first.id(), second.id());
+}
+
+TEST_F(SongTest, DifferentPathGetsNewId) {
+    const Song first("song.mp3", "/music/song.mp3");
+    const Song second("song.mp3", "/other/song.mp3");
+    EXPECT_NE(first.id(), second.id());
+}
+
+TEST_F(SongTest, DifferentNameIsNotEqual) {
+    const Song first("a.mp3", "/s");
+    const Song second("b.mp3", "/s");
+    EXPECT_FALSE(first.isEqualTo(second));
+}
@@ -1,6 +1,7 @@
 #include "SortingTest.h"
 #include <filesystem>
 #include <fstream>
+#include <algorithm>
 
 void ShellSortTest::SetUp() {
     test_directory_ = std::filesystem::temp_directory_path().string() + "/shell_sort_test";
@@ -17,6 +18,74 @@ std::string ShellSortTest::createFile(const std::string& name, const int size) c
     return path;
 }
 
+std::string ShellSortTest::createWave(const std::string& name, const int byteRate, const int dataSize) const {
+    const auto word = [](std::ofstream& out, const std::uint32_t value, const int width) {
+        for (int i = 0; i < width; i++) out.put(static_cast<char>(value >> (8 * i)));
+    };
+    const std::string path = test_directory_ + "/" + name;
+    std::ofstream out(path, std::ios::binary);
+    out << "RIFF";
+    word(out, 36 + dataSize, 4);
+    out << "WAVEfmt ";
+    word(out, 16, 4);
+    word(out, 1, 2);
+    word(out, 1, 2);
+    word(out, byteRate, 4);
+    word(out, byteRate, 4);
+    word(out, 1, 2);
+    word(out, 8, 2);
+    out << "data";
+    word(out, dataSize, 4);
+    out << std::string(dataSize, '\x80');
+    return path;
+}
+
+void AlbumSortTest::SetUp() {
+    test_directory_ = std::filesystem::temp_directory_path().string() + "/album_sort_test";
+    std::filesystem::create_directories(test_directory_);
+}
+
+void AlbumSortTest::TearDown() {
+    std::filesystem::remove_all(test_directory_);
+}
+
+std::string AlbumSortTest::createTagged(const std::string& name, const std::string& artist, const std::string& album,
+                                        const int track) const {
+    std::string info = "INFO";
+    const auto field = [&info](const std::string& id, std::string value) {
+        value.push_back('\0');
+        if (value.size() & 1) value.push_back('\0');
+        info += id;
+        for (int i = 0; i < 4; i++) info.push_back(static_cast<char>(value.size() >> (8 * i)));
+        info += value;
+    };
+    field("IART", artist);
+    field("IPRD", album);
+    if (track > 0) field("ITRK", std::to_string(track));
+
+    const std::string path = test_directory_ + "/" + name;
+    std::ofstream out(path, std::ios::binary);
+    out << "RIFF" << std::string(4, '\0') << "WAVELIST";
+    for (int i = 0; i < 4; i++) out.put(static_cast<char>(info.size() >> (8 * i)));
+    out << info;
+    return path;
+}
+
+void CountingSort::visit(const std::string& name, const std::string&) {
+    extractions_++;
+    keys_.push_back(static_cast<int>(name.size()));
+}
+
+void CountingSort::order(std::vector<int>& indices) const {
+    std::ranges::stable_sort(indices, [this](const int left, const int right) {
+        return keys_[left] < keys_[right];
+    });
+}
+
+int CountingSort::extractions() const {
+    return extractions_;
+}
+
 TEST_F(ShellSortTest, SortByDurationAscending) {
     const std::string c = createFile("c.mp3", 300);
     const std::string a = createFile("a.mp3", 100);
@@ -106,6 +175,15 @@ TEST_F(ShellSortTest, SortLargeCollection) {
     EXPECT_TRUE(visitor_.hasNameAt(0, "1.mp3"));
 }
 
+TEST_F(ShellSortTest, SortByDurationNotFileSize) {
+    const std::string longer = createWave("longer.wav", 8000, 16000);
+    const std::string shorter = createWave("shorter.wav", 176400, 88200);
+    std::vector<Song> songs = {Song("longer.wav", longer), Song("shorter.wav", shorter)};
+    sorter_.sort(songs);
+    songs[0].accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "shorter.wav"));
+}
+
 TEST_F(QuickSortTest, SortByNameAlphabetical) {
     std::vector<Song> songs = {
         Song("C.mp3", "/c"),
@@ -165,6 +243,42 @@ TEST_F(QuickSortTest, SortDuplicateNames) {
     EXPECT_TRUE(visitor_.hasNameAt(0, "A.mp3"));
 }
 
+TEST_F(QuickSortTest, SortLargeSortedCollectionInParallel) {
+    std::vector<Song> songs;
+    for (int i = 0; i < 40000; i++) {
+        songs.emplace_back("song" + std::string(6 - std::to_string(i).size(), '0') + std::to_string(i) + ".mp3", "/sorted");
+    }
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "song000000.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(20000, "song020000.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(39999, "song039999.mp3"));
+}
+
+TEST_F(QuickSortTest, SortLargeReversedCollectionInParallel) {
+    std::vector<Song> songs;
+    for (int i = 39999; i >= 0; i--) {
+        songs.emplace_back("song" + std::string(6 - std::to_string(i).size(), '0') + std::to_string(i) + ".mp3", "/reversed");
+    }
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "song000000.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(39999, "song039999.mp3"));
+}
+
+TEST_F(QuickSortTest, SortKeepsDuplicateNamesInOriginalOrder) {
+    std::vector<Song> songs = {Song("B.mp3", "/b1"), Song("A.mp3", "/a"), Song("B.mp3", "/b2")};
+    const std::uint64_t first = songs[0].id();
+    const std::uint64_t second = songs[2].id();
+    sorter_.sort(songs);
+    EXPECT_EQ(first, songs[1].id());
+    EXPECT_EQ(second, songs[2].id());
+}
+
 TEST_F(QuickSortTest, SortLargeCollection) {
     std::vector<Song> songs;
     for (int i = 100; i > 0; i--) {
@@ -204,3 +318,170 @@ TEST_F(QuickSortTest, SortNumberedSongsByTitle) {
     songs[0].accept(visitor_);
     EXPECT_TRUE(visitor_.hasNameAt(0, "(3) Apple.mp3"));
 }
+
+TEST_F(QuickSortTest, SortNumbersNaturally) {
+    std::vector<Song> songs = {
+        Song("Track 10.mp3", "/10"),
+        Song("Track 2.mp3", "/2"),
+        Song("Track 1.mp3", "/1")
+    };
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Track 1.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "Track 2.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "Track 10.mp3"));
+}
+
+TEST_F(QuickSortTest, SortIgnoresCaseAndAccents) {
+    std::vector<Song> songs = {
+        Song("banana.mp3", "/b"),
+        Song("\xc3\x89t\xc3\xa9.mp3", "/e"),
+        Song("Apple.mp3", "/a")
+    };
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Apple.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "banana.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "\xc3\x89t\xc3\xa9.mp3"));
+}
+
+TEST_F(KeyedSortTest, ExtractsEachKeyOnce) {
+    std::vector<Song> songs;
+    for (int i = 50; i > 0; i--) {
+        songs.emplace_back(std::string(i, 'x') + ".mp3", "/s");
+    }
+    sorter_.sort(songs);
+    EXPECT_EQ(50, sorter_.extractions());
+}
+
+TEST_F(KeyedSortTest, PermutesSongsByExtractedKeys) {
+    std::vector<Song> songs = {
+        Song("ccc.mp3", "/c"),
+        Song("a.mp3", "/a"),
+        Song("bb.mp3", "/b")
+    };
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "ccc.mp3"));
+}
+
+TEST_F(KeyedSortTest, KeepsPathsWithTheirNames) {
+    std::vector<Song> songs = {Song("bb.mp3", "/b"), Song("a.mp3", "/a")};
+    sorter_.sort(songs);
+    songs[0].accept(visitor_);
+    EXPECT_TRUE(visitor_.hasPath("/a"));
+}
+
+TEST_F(KeyedSortTest, RecallsRetainedOrderWithoutExtraction) {
+    std::vector<Song> songs = {Song("ccc.mp3", "/c"), Song("a.mp3", "/a"), Song("bb.mp3", "/b")};
+    sorter_.sort(songs);
+    sorter_.retain(7);
+    std::ranges::reverse(songs);
+    EXPECT_TRUE(sorter_.recall(songs, 7));
+    EXPECT_EQ(3, sorter_.extractions());
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "bb.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "ccc.mp3"));
+}
+
+TEST_F(KeyedSortTest, RefusesRecallForOtherGeneration) {
+    std::vector<Song> songs = {Song("bb.mp3", "/b"), Song("a.mp3", "/a")};
+    sorter_.sort(songs);
+    sorter_.retain(1);
+    EXPECT_FALSE(sorter_.recall(songs, 2));
+}
+
+TEST_F(KeyedSortTest, RefusesRecallBeforeRetain) {
+    std::vector<Song> songs = {Song("bb.mp3", "/b"), Song("a.mp3", "/a")};
+    sorter_.sort(songs);
+    EXPECT_FALSE(sorter_.recall(songs, 0));
+}
+
+TEST_F(KeyedSortTest, RefusesRecallForDifferentSongs) {
+    std::vector<Song> songs = {Song("bb.mp3", "/b"), Song("a.mp3", "/a")};
+    sorter_.sort(songs);
+    sorter_.retain(1);
+    std::vector<Song> others = {Song("bb.mp3", "/b"), Song("c.mp3", "/c")};
+    EXPECT_FALSE(sorter_.recall(others, 1));
+}
+
+TEST_F(KeyedSortTest, SortEmptyVector) {
+    std::vector<Song> songs;
+    sorter_.sort(songs);
+    EXPECT_EQ(0, sorter_.extractions());
+}
+
+TEST_F(AlbumSortTest, OrdersByArtistThenAlbumThenTrack) {
+    std::vector<Song> songs = {
+        Song("b2.mp3", createTagged("b2.wav", "Beta", "Second", 2)),
+        Song("a2.mp3", createTagged("a2.wav", "Alpha", "First", 2)),
+        Song("b1.mp3", createTagged("b1.wav", "Beta", "First", 1)),
+        Song("a1.mp3", createTagged("a1.wav", "Alpha", "First", 1)),
+        Song("b3.mp3", createTagged("b3.wav", "Beta", "Second", 1)),
+    };
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a1.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "a2.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "b1.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(3, "b3.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(4, "b2.mp3"));
+}
+
+TEST_F(AlbumSortTest, IgnoresCaseOfFields) {
+    std::vector<Song> songs = {
+        Song("b.mp3", createTagged("b.wav", "beta", "Album", 1)),
+        Song("a.mp3", createTagged("a.wav", "ALPHA", "Album", 1)),
+    };
+    sorter_.sort(songs);
+    songs[0].accept(visitor_);
+    EXPECT_TRUE(visitor_.hasNameAt(0, "a.mp3"));
+}
+
+TEST_F(AlbumSortTest, OrdersUntaggedSongsByTitle) {
+    std::vector<Song> songs = {
+        Song("Zulu.mp3", test_directory_ + "/Zulu.mp3"),
+        Song("Alpha.mp3", test_directory_ + "/Alpha.mp3"),
+        Song("Mike.mp3", test_directory_ + "/Mike.mp3"),
+    };
+    sorter_.sort(songs);
+    for (const Song& song : songs) {
+        song.accept(visitor_);
+    }
+    EXPECT_TRUE(visitor_.hasNameAt(0, "Alpha.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(1, "Mike.mp3"));
+    EXPECT_TRUE(visitor_.hasNameAt(2, "Zulu.mp3"));
+}
+
+TEST_F(AlbumSortTest, KeepsEqualKeysInOriginalOrder) {
+    std::vector<Song> songs = {
+        Song("same.mp3", test_directory_ + "/c/same.mp3"),
+        Song("same.mp3", test_directory_ + "/a/same.mp3"),
+        Song("same.mp3", test_directory_ + "/b/same.mp3"),
+    };
+    std::vector<std::uint64_t> before;
+    for (const Song& song : songs) before.push_back(song.id());
+    sorter_.sort(songs);
+    std::vector<std::uint64_t> after;
+    for (const Song& song : songs) after.push_back(song.id());
+    EXPECT_EQ(before, after);
+}
+
+TEST_F(AlbumSortTest, SortEmptyVector) {
+    std::vector<Song> songs;
+    sorter_.sort(songs);
+    EXPECT_TRUE(songs.empty());
+}
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include "model/arrangement/DurationSort.h"
 #include "model/arrangement/QuickSort.h"
+#include "model/arrangement/AlbumSort.h"
+#include "model/arrangement/KeyedSort.h"
 #include "model/core/Song.h"
 #include "../TestPlaylistVisitor.h"
 #include <vector>
@@ -18,6 +20,7 @@ protected:
     void SetUp() override;
     void TearDown() override;
     std::string createFile(const std::string& name, int size) const;
+    std::string createWave(const std::string& name, int byteRate, int dataSize) const;
 };
 
 class QuickSortTest : public ::testing::Test {
@@ -26,4 +29,33 @@ protected:
     TestPlaylistVisitor visitor_;
 };
 
+class AlbumSortTest : public ::testing::Test {
+protected:
+    std::string test_directory_;
+    AlbumSort sorter_;
+    TestPlaylistVisitor visitor_;
+
+    void SetUp() override;
+    void TearDown() override;
+    std::string createTagged(const std::string& name, const std::string& artist, const std::string& album,
+                             int track) const;
+};
+
+class CountingSort final : public KeyedSort<int> {
+private:
+    int extractions_ = 0;
+
+    void visit(const std::string& name, const std::string& path) override;
+    void order(std::vector<int>& indices) const override;
+
+public:
+    int extractions() const;
+};
+
+class KeyedSortTest : public ::testing::Test {
+protected:
+    CountingSort sorter_;
+    TestPlaylistVisitor visitor_;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "TagReaderTest.h"
+#include "model/core/TagReader.h"
+
+std::string TagReaderTest::identify() const {
+    return "tag_reader_test";
+}
+
+std::vector<std::uint8_t> TagReaderTest::id3v2(const int version,
+                                               const std::vector<std::pair<std::string, std::vector<std::uint8_t>>>& frames) {
+    std::vector<std::uint8_t> body;
+    for (const auto& [id, payload] : frames) {
+        append(body, id);
+        const std::uint32_t size = payload.size();
+        if (version == 2) {
+            body.insert(body.end(), {static_cast<std::uint8_t>(size >> 16), static_cast<std::uint8_t>(size >> 8),
+                                     static_cast<std::uint8_t>(size)});
+        } else if (version == 3) {
+            body.insert(body.end(), {static_cast<std::uint8_t>(size >> 24), static_cast<std::uint8_t>(size >> 16),
+                                     static_cast<std::uint8_t>(size >> 8), static_cast<std::uint8_t>(size)});
+        } else {
+            body.insert(body.end(), {static_cast<std::uint8_t>(size >> 21 & 0x7F), static_cast<std::uint8_t>(size >> 14 & 0x7F),
+                                     static_cast<std::uint8_t>(size >> 7 & 0x7F), static_cast<std::uint8_t>(size & 0x7F)});
+        }
+        if (version != 2) body.insert(body.end(), {0, 0});
+        body.insert(body.end(), payload.begin(), payload.end());
+    }
+    body.resize(body.size() + 16, 0);
+
+    std::vector<std::uint8_t> bytes;
+    append(bytes, "ID3");
+    const std::uint32_t size = body.size();
+    bytes.insert(bytes.end(), {static_cast<std::uint8_t>(version), 0, 0,
+                               static_cast<std::uint8_t>(size >> 21 & 0x7F), static_cast<std::uint8_t>(size >> 14 & 0x7F),
+                               static_cast<std::uint8_t>(size >> 7 & 0x7F), static_cast<std::uint8_t>(size & 0x7F)});
+    bytes.insert(bytes.end(), body.begin(), body.end());
+    bytes.insert(bytes.end(), {0xFF, 0xFB, 0x90, 0x00});
+    bytes.resize(bytes.size() + 413, 0);
+    return bytes;
+}
+
+std::vector<std::uint8_t> TagReaderTest::id3v1(const std::string& title, const std::string& artist,
+                                               const std::string& album, const std::string& year,
+                                               const std::uint8_t track) {
+    std::vector<std::uint8_t> bytes(200, 0);
+    const std::size_t start = bytes.size();
+    bytes.resize(start + 128, 0);
+    std::copy(std::begin("TAG"), std::end("TAG") - 1, bytes.begin() + start);
+    std::copy(title.begin(), title.end(), bytes.begin() + start + 3);
+    std::copy(artist.begin(), artist.end(), bytes.begin() + start + 33);
+    std::copy(album.begin(), album.end(), bytes.begin() + start + 63);
+    std::copy(year.begin(), year.end(), bytes.begin() + start + 93);
+    bytes[start + 126] = track;
+    return bytes;
+}
+
+std::vector<std::uint8_t> TagReaderTest::wave(const std::vector<std::pair<std::string, std::string>>& fields) {
+    std::vector<std::uint8_t> info;
+    append(info, "INFO");
+    for (const auto& [id, value] : fields) {
+        append(info, id);
+        appendLittle(info, value.size() + 1);
+        append(info, value);
+        info.push_back(0);
+        if ((value.size() + 1) & 1) info.push_back(0);
+    }
+
+    std::vector<std::uint8_t> bytes;
+    append(bytes, "RIFF");
+    appendLittle(bytes, 0);
+    append(bytes, "WAVE");
+    append(bytes, "fmt ");
+    appendLittle(bytes, 16);
+    bytes.resize(bytes.size() + 16, 1);
+    append(bytes, "LIST");
+    appendLittle(bytes, info.size());
+    bytes.insert(bytes.end(), info.begin(), info.end());
+    append(bytes, "data");
+    appendLittle(bytes, 8);
+    bytes.resize(bytes.size() + 8, 0x80);
+    return bytes;
+}
+
+std::vector<std::uint8_t> TagReaderTest::text(const std::string& value, const std::uint8_t encoding) {
+    std::vector<std::uint8_t> bytes = {encoding};
+    append(bytes, value);
+    return bytes;
+}
+
+TEST_F(TagReaderTest, MissingFileHasNoTags) {
+    const TagReader::Tags tags = TagReader::read(test_directory_ + "/missing.mp3");
+    EXPECT_TRUE(tags.title.empty());
+    EXPECT_EQ(0, tags.track);
+}
+
+TEST_F(TagReaderTest, UntaggedFileHasNoTags) {
+    const TagReader::Tags tags = TagReader::read(writeFile("plain.mp3", std::vector<std::uint8_t>(500, 0x11)));
+    EXPECT_TRUE(tags.artist.empty());
+    EXPECT_EQ(0, tags.year);
+}
+
+TEST_F(TagReaderTest, ReadsId3v24Frames) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(4, {
+        {"TIT2", text("Title")}, {"TPE1", text("Artist")}, {"TALB", text("Album")},
+        {"TRCK", text("3/12")}, {"TDRC", text("2004-05-01")},
+    })));
+    EXPECT_EQ("Title", tags.title);
+    EXPECT_EQ("Artist", tags.artist);
+    EXPECT_EQ("Album", tags.album);
+    EXPECT_EQ(3, tags.track);
+    EXPECT_EQ(2004, tags.year);
+}
+
+TEST_F(TagReaderTest, ReadsId3v23Frames) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(3, {
+        {"TPE1", text("Artist", 0)}, {"TYER", text("1999", 0)},
+    })));
+    EXPECT_EQ("Artist", tags.artist);
+    EXPECT_EQ(1999, tags.year);
+}
+
+TEST_F(TagReaderTest, ReadsId3v22Frames) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(2, {
+        {"TT2", text("Short", 0)}, {"TRK", text("7", 0)},
+    })));
+    EXPECT_EQ("Short", tags.title);
+    EXPECT_EQ(7, tags.track);
+}
+
+TEST_F(TagReaderTest, DecodesLatinText) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(3, {
+        {"TPE1", {0, 'B', 'j', 0xF6, 'r', 'k'}},
+    })));
+    EXPECT_EQ("Bj\xC3\xB6rk", tags.artist);
+}
+
+TEST_F(TagReaderTest, DecodesUtf16TextWithByteOrderMark) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(3, {
+        {"TIT2", {1, 0xFF, 0xFE, 'H', 0, 'i', 0, 0xAC, 0x20, 0, 0}},
+    })));
+    EXPECT_EQ("Hi\xE2\x82\xAC", tags.title);
+}
+
+TEST_F(TagReaderTest, DecodesUtf16BigEndianSurrogates) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v2(4, {
+        {"TIT2", {2, 0xD8, 0x3C, 0xDF, 0xB5}},
+    })));
+    EXPECT_EQ("\xF0\x9F\x8E\xB5", tags.title);
+}
+
+TEST_F(TagReaderTest, UndoesTagUnsynchronisation) {
+    std::vector<std::uint8_t> bytes = id3v2(3, {{"TIT2", {0, 'A', 0xFF, 'B'}}});
+    bytes[5] = 0x80;
+    bytes.insert(bytes.begin() + 23, 0x00);
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", bytes));
+    EXPECT_EQ("A\xC3\xBF" "B", tags.title);
+}
+
+TEST_F(TagReaderTest, UndoesFrameUnsynchronisation) {
+    std::vector<std::uint8_t> bytes = id3v2(4, {{"TIT2", {0, 'A', 0xFF, 0x00, 'B'}}, {"TPE1", text("Artist")}});
+    bytes[19] = 0x02;
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", bytes));
+    EXPECT_EQ("A\xC3\xBF" "B", tags.title);
+    EXPECT_EQ("Artist", tags.artist);
+}
+
+TEST_F(TagReaderTest, ReadsId3v1Trailer) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", id3v1("Title", "Artist", "Album", "1987", 4)));
+    EXPECT_EQ("Title", tags.title);
+    EXPECT_EQ("Artist", tags.artist);
+    EXPECT_EQ("Album", tags.album);
+    EXPECT_EQ(1987, tags.year);
+    EXPECT_EQ(4, tags.track);
+}
+
+TEST_F(TagReaderTest, Id3v2TakesPrecedenceOverId3v1) {
+    std::vector<std::uint8_t> bytes = id3v2(3, {{"TIT2", text("Modern")}});
+    const std::vector<std::uint8_t> trailer = id3v1("Legacy", "Artist", "", "", 0);
+    bytes.insert(bytes.end(), trailer.end() - 128, trailer.end());
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", bytes));
+    EXPECT_EQ("Modern", tags.title);
+    EXPECT_EQ("Artist", tags.artist);
+}
+
+TEST_F(TagReaderTest, ReadsRiffInfoChunk) {
+    const TagReader::Tags tags = TagReader::read(writeFile("song.wav", wave({
+        {"INAM", "Title"}, {"IART", "Artist"}, {"IPRD", "Album"}, {"ITRK", "2"}, {"ICRD", "2011"},
+    })));
+    EXPECT_EQ("Title", tags.title);
+    EXPECT_EQ("Artist", tags.artist);
+    EXPECT_EQ("Album", tags.album);
+    EXPECT_EQ(2, tags.track);
+    EXPECT_EQ(2011, tags.year);
+}
+
+TEST_F(TagReaderTest, TruncatedFrameIsIgnored) {
+    std::vector<std::uint8_t> bytes = id3v2(3, {{"TIT2", text("Title")}});
+    bytes[17] = 0x7F;
+    const TagReader::Tags tags = TagReader::read(writeFile("song.mp3", bytes));
+    EXPECT_TRUE(tags.title.empty());
+}
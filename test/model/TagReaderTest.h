@@ -0,0 +1,19 @@
+#ifndef TAG_READER_TEST_H
+#define TAG_READER_TEST_H
+
+#include "../DirectoryTestFixture.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TagReaderTest : public DirectoryTestFixture {
+protected:
+    std::string identify() const override;
+    static std::vector<std::uint8_t> id3v2(int version, const std::vector<std::pair<std::string, std::vector<std::uint8_t>>>& frames);
+    static std::vector<std::uint8_t> id3v1(const std::string& title, const std::string& artist, const std::string& album,
+                                           const std::string& year, std::uint8_t track);
+    static std::vector<std::uint8_t> wave(const std::vector<std::pair<std::string, std::string>>& fields);
+    static std::vector<std::uint8_t> text(const std::string& value, std::uint8_t encoding = 3);
+};
+
+#endif //TAG_READER_TEST_H
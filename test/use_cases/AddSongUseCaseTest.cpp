@@ -13,7 +13,7 @@ std::string AddSongUseCaseTest::prepare(const std::string& name) const {
     const std::string src_directory_ = base_directory_ + "/src";
     std::filesystem::create_directories(src_directory_);
     std::string path = src_directory_ + "/" + name;
-    std::ofstream(path) << "audio";
+    std::ofstream(path) << "audio " << name;
     return path;
 }
 
@@ -0,0 +1,130 @@
+#include "ImportSongUseCaseTest.h"
+#include "../TestPlaylistVisitor.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+std::string ImportSongUseCaseTest::identify() const {
+    return "import_uc";
+}
+
+std::string ImportSongUseCaseTest::stage(const std::string& name) const {
+    const std::string folder = base_directory_ + "/import";
+    std::filesystem::create_directories(folder);
+    std::ofstream(folder + "/" + name) << "audio " << name;
+    return folder + "/" + name;
+}
+
+void ImportSongUseCaseTest::settle(MockPlaybackListener& listener) {
+    for (int attempt = 0; attempt < 200 && !listener.wasChanged(); attempt++) {
+        loop_.awaits();
+        loop_.drain();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    loop_.drain();
+}
+
+TEST_F(ImportSongUseCaseTest, ImportedSongJoinsPlaylist) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    musicPlayer.import(stage("new.mp3"));
+    settle(listener_);
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(1));
+    EXPECT_TRUE(visitor.hasPath(music_directory_ + "/new.mp3"));
+    EXPECT_TRUE(listener_.wasFeedback("Song added successfully!"));
+}
+
+TEST_F(ImportSongUseCaseTest, ImportReportsProgress) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    musicPlayer.import(stage("new.mp3"));
+    settle(listener_);
+    EXPECT_TRUE(listener_.wasProgressedTo(100));
+}
+
+TEST_F(ImportSongUseCaseTest, ImportDoesNotDuplicateWatchedFile) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    musicPlayer.import(stage("new.mp3"));
+    settle(listener_);
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(1));
+}
+
+TEST_F(ImportSongUseCaseTest, ImportRejectsUnsupportedFileImmediately) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    musicPlayer.import(stage("notes.txt"));
+    EXPECT_TRUE(listener_.wasFeedback("Unsupported file type."));
+}
+
+TEST_F(ImportSongUseCaseTest, ImportRejectsSongAlreadyQueued) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    const std::string path = stage("new.mp3");
+    musicPlayer.import(path);
+    musicPlayer.import(path);
+    settle(listener_);
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(1));
+    EXPECT_TRUE(listener_.wasFeedback("This song already exists."));
+}
+
+TEST_F(ImportSongUseCaseTest, ImportWithoutLoopRunsInline) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.import(stage("new.mp3"));
+    EXPECT_TRUE(listener_.wasChanged());
+    EXPECT_TRUE(listener_.wasFeedback("Song added successfully!"));
+}
+
+TEST_F(ImportSongUseCaseTest, BatchImportNotifiesOnce) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    std::vector<std::string> paths;
+    for (int i = 0; i < 10; i++) {
+        paths.push_back(stage("song" + std::to_string(i) + ".mp3"));
+    }
+    musicPlayer.import(paths);
+    settle(listener_);
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(10));
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+    EXPECT_TRUE(listener_.wasFeedback("10 songs added successfully!"));
+}
+
+TEST_F(ImportSongUseCaseTest, BatchImportSummarizesSkippedFiles) {
+    createSong("existing.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    const std::string fresh = stage("fresh.mp3");
+    musicPlayer.import({fresh, fresh, stage("existing.mp3"), stage("notes.txt")});
+    settle(listener_);
+    EXPECT_TRUE(listener_.wasFeedback("Added 1 of 4 songs.\n"
+                                      "This song already exists. (2)\n"
+                                      "Unsupported file type. (1)"));
+}
+
+TEST_F(ImportSongUseCaseTest, BatchImportWithoutLoopNotifiesOnce) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.import({stage("a.mp3"), stage("b.mp3"), stage("c.mp3")});
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(3));
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+    EXPECT_TRUE(listener_.wasFeedback("3 songs added successfully!"));
+}
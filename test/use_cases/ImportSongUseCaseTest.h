@@ -0,0 +1,16 @@
+#ifndef IMPORT_SONG_USE_CASE_TEST_H
+#define IMPORT_SONG_USE_CASE_TEST_H
+
+#include "../ModelTestFixture.h"
+#include "../QueuedEventLoop.h"
+
+class ImportSongUseCaseTest : public ModelTestFixture {
+protected:
+    QueuedEventLoop loop_;
+
+    std::string identify() const override;
+    std::string stage(const std::string& name) const;
+    void settle(MockPlaybackListener& listener);
+};
+
+#endif //IMPORT_SONG_USE_CASE_TEST_H
@@ -20,6 +20,16 @@ TEST_F(RemoveSongUseCaseTest, RemoveFirstSong) {
     EXPECT_TRUE(visitor.hasSongs(2));
 }
 
+TEST_F(RemoveSongUseCaseTest, RemoveReportsRemovedRow) {
+    createSong("a.mp3");
+    createSong("b.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.remove(1);
+    EXPECT_TRUE(listener_.wasRemoved(1, 1));
+    EXPECT_FALSE(listener_.wasInserted(0, 2));
+}
+
 TEST_F(RemoveSongUseCaseTest, RemoveLastSong) {
     createSong("a.mp3");
     createSong("b.mp3");
@@ -4,6 +4,7 @@
 #include "model/arrangement/DurationSort.h"
 #include <filesystem>
 #include <fstream>
+#include <stdexcept>
 
 std::string SortPlaylistUseCaseTest::identify() const {
     return "sort_uc";
@@ -393,3 +394,132 @@ TEST_F(SortPlaylistUseCaseTest, SortThenSearchFindsCorrectly) {
     musicPlayer.search("apple", visitor);
     EXPECT_TRUE(visitor.hasName("apple.mp3"));
 }
+
+TEST_F(SortPlaylistUseCaseTest, BatchNotifiesChangedOnce) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        musicPlayer.reverse();
+    });
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+}
+
+TEST_F(SortPlaylistUseCaseTest, BatchAppliesEveryOperation) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    createSong("c.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        musicPlayer.reverse();
+    });
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasNameAt(0, "c.mp3"));
+    EXPECT_TRUE(visitor.hasNameAt(2, "a.mp3"));
+}
+
+TEST_F(SortPlaylistUseCaseTest, NestedBatchNotifiesAtOutermostEnd) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    musicPlayer.batch([&] {
+        musicPlayer.batch([&] { musicPlayer.sort(byTitle); });
+        EXPECT_FALSE(listener_.wasChanged());
+        musicPlayer.reverse();
+    });
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+}
+
+TEST_F(SortPlaylistUseCaseTest, BatchDefersSelection) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        musicPlayer.play(0);
+        musicPlayer.advance();
+        EXPECT_FALSE(listener_.wasSelected());
+    });
+    EXPECT_TRUE(listener_.wasSelectedWith(1));
+    EXPECT_FALSE(listener_.wasSelectedWith(0));
+}
+
+TEST_F(SortPlaylistUseCaseTest, EmptyBatchStaysSilent) {
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.batch([] {});
+    EXPECT_FALSE(listener_.wasChanged());
+    EXPECT_FALSE(listener_.wasSelected());
+}
+
+TEST_F(SortPlaylistUseCaseTest, ThrowingBatchStillNotifies) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    EXPECT_ANY_THROW(musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        throw std::runtime_error("interrupted");
+    }));
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+    musicPlayer.reverse();
+    musicPlayer.play(0);
+    EXPECT_TRUE(listener_.wasChangedTimes(2));
+    EXPECT_TRUE(listener_.wasSelectedWith(0));
+}
+
+TEST_F(SortPlaylistUseCaseTest, BatchStartsSongAfterSelectingIt) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    QuickSort byTitle;
+    musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        musicPlayer.play(0);
+        musicPlayer.advance();
+        EXPECT_FALSE(listener_.wasStarted());
+    });
+    const std::vector<std::string> expected{"select 1", "start " + music_directory_ + "/b.mp3"};
+    EXPECT_EQ(expected, listener_.history());
+}
+
+TEST_F(SortPlaylistUseCaseTest, ThrowingListenerDuringUnwindKeepsBatchError) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    listener_.fail();
+    QuickSort byTitle;
+    EXPECT_THROW(musicPlayer.batch([&] {
+        musicPlayer.sort(byTitle);
+        throw std::runtime_error("interrupted");
+    }), std::runtime_error);
+    musicPlayer.play(0);
+    EXPECT_TRUE(listener_.wasSelectedWith(0));
+}
+
+TEST_F(SortPlaylistUseCaseTest, ThrowingListenerAfterBatchPropagates) {
+    createSong("b.mp3");
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    listener_.fail();
+    QuickSort byTitle;
+    EXPECT_THROW(musicPlayer.batch([&] { musicPlayer.sort(byTitle); }), std::logic_error);
+    musicPlayer.play(0);
+    EXPECT_TRUE(listener_.wasSelectedWith(0));
+}
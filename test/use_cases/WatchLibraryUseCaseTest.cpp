@@ -0,0 +1,118 @@
+#include "WatchLibraryUseCaseTest.h"
+#include "../TestPlaylistVisitor.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+std::string WatchLibraryUseCaseTest::identify() const {
+    return "watch_uc";
+}
+
+void WatchLibraryUseCaseTest::settle() {
+    ASSERT_TRUE(loop_.awaits());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    loop_.drain();
+}
+
+TEST_F(WatchLibraryUseCaseTest, NewFileJoinsPlaylist) {
+    createSong("a.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    createSong("b.mp3");
+    settle();
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(2));
+    EXPECT_TRUE(visitor.hasPath(music_directory_ + "/b.mp3"));
+}
+
+TEST_F(WatchLibraryUseCaseTest, DeletedFileLeavesPlaylist) {
+    createSong("a.mp3");
+    createSong("b.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.attach(loop_);
+    std::filesystem::remove(music_directory_ + "/a.mp3");
+    settle();
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(1));
+    EXPECT_TRUE(visitor.hasName("b.mp3"));
+}
+
+TEST_F(WatchLibraryUseCaseTest, BurstNotifiesOnce) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.subscribe(listener_);
+    musicPlayer.attach(loop_);
+    for (int i = 0; i < 20; i++) {
+        createSong("song" + std::to_string(i) + ".mp3");
+    }
+    settle();
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(20));
+    EXPECT_TRUE(listener_.wasChangedTimes(1));
+}
+
+TEST_F(WatchLibraryUseCaseTest, NewAlbumFolderJoinsPlaylist) {
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.attach(loop_);
+    const std::string staging = base_directory_ + "/staging";
+    std::filesystem::create_directories(staging);
+    std::ofstream(staging + "/one.mp3") << "audio";
+    std::ofstream(staging + "/two.mp3") << "audio";
+    std::filesystem::rename(staging, music_directory_ + "/Album");
+    settle();
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(2));
+    EXPECT_TRUE(visitor.hasPath(music_directory_ + "/Album/one.mp3"));
+}
+
+TEST_F(WatchLibraryUseCaseTest, RemovedAlbumFolderLeavesPlaylist) {
+    createSong("a.mp3");
+    std::filesystem::create_directories(music_directory_ + "/Album");
+    createSong("Album/one.mp3");
+    createSong("Album/two.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.attach(loop_);
+    std::filesystem::remove_all(music_directory_ + "/Album");
+    settle();
+    TestPlaylistVisitor visitor;
+    musicPlayer.accept(visitor);
+    EXPECT_TRUE(visitor.hasSongs(1));
+    EXPECT_TRUE(visitor.hasName("a.mp3"));
+}
+
+TEST_F(WatchLibraryUseCaseTest, KeepsOrderOfExistingSongs) {
+    createSong("a.mp3");
+    createSong("b.mp3");
+    createSong("c.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_);
+    musicPlayer.attach(loop_);
+    TestPlaylistVisitor before;
+    musicPlayer.accept(before);
+    createSong("d.mp3");
+    settle();
+    TestPlaylistVisitor after;
+    musicPlayer.accept(after);
+    EXPECT_TRUE(after.hasSongs(4));
+    EXPECT_TRUE(after.hasNameAt(3, "d.mp3"));
+}
+
+TEST_F(WatchLibraryUseCaseTest, ScanPopulatesThroughEventLoop) {
+    createSong("a.mp3");
+    createSong("b.mp3");
+    createSong("c.mp3");
+    MusicPlayer musicPlayer(base_directory_, ad_policy_, loop_);
+    musicPlayer.subscribe(listener_);
+    TestPlaylistVisitor before;
+    musicPlayer.accept(before);
+    EXPECT_TRUE(before.isEmpty());
+    settle();
+    TestPlaylistVisitor after;
+    musicPlayer.accept(after);
+    EXPECT_TRUE(after.hasSongs(3));
+    EXPECT_TRUE(listener_.wasChanged());
+}
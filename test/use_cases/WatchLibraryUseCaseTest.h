@@ -0,0 +1,15 @@
+#ifndef WATCH_LIBRARY_USE_CASE_TEST_H
+#define WATCH_LIBRARY_USE_CASE_TEST_H
+
+#include "../ModelTestFixture.h"
+#include "../QueuedEventLoop.h"
+
+class WatchLibraryUseCaseTest : public ModelTestFixture {
+protected:
+    QueuedEventLoop loop_;
+
+    std::string identify() const override;
+    void settle();
+};
+
+#endif //WATCH_LIBRARY_USE_CASE_TEST_H
@@ -1,13 +1,18 @@
 #ifndef I_DISPLAY_VIEW_H
 #define I_DISPLAY_VIEW_H
 
+#include "IPlaylistSnapshot.h"
+#include <memory>
 #include <string>
 #include <vector>
 
 class IDisplayView {
 public:
     virtual ~IDisplayView() = default;
-    virtual void refresh(const std::vector<std::string>& names) = 0;
+    virtual void refresh(std::shared_ptr<const IPlaylistSnapshot> playlist) = 0;
+    virtual void insert(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) = 0;
+    virtual void erase(std::shared_ptr<const IPlaylistSnapshot> playlist, std::size_t first, std::size_t count) = 0;
+    virtual void reorder(std::shared_ptr<const IPlaylistSnapshot> playlist, const std::vector<std::size_t>& order) = 0;
     virtual void highlight(int index) = 0;
     virtual void suggest(const std::vector<std::string>& names) = 0;
     virtual void dismiss() = 0;
@@ -10,6 +10,7 @@ public:
     virtual bool confirm(const std::string& message) = 0;
     virtual void reveal(bool visible) = 0;
     virtual void enable(bool state) = 0;
+    virtual void progress(const std::string& name, int percent) = 0;
 };
 
 #endif //I_LIBRARY_VIEW_H
\ No newline at end of file
@@ -7,6 +7,7 @@ class IPlaybackView {
 public:
     virtual ~IPlaybackView() = default;
     virtual void play(const std::string& path) = 0;
+    virtual void measure(int duration) = 0;
     virtual void pause() = 0;
     virtual void resume() = 0;
     virtual void stop() = 0;
@@ -0,0 +1,16 @@
+#ifndef I_PLAYLIST_SNAPSHOT_H
+#define I_PLAYLIST_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+class IPlaylistSnapshot {
+public:
+    virtual ~IPlaylistSnapshot() = default;
+    virtual std::size_t size() const = 0;
+    virtual std::uint64_t id(std::size_t row) const = 0;
+    virtual std::string_view name(std::size_t row) const = 0;
+};
+
+#endif //I_PLAYLIST_SNAPSHOT_H